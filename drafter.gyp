@@ -303,8 +303,16 @@
         "packages/drafter/src/NamedTypesRegistry.h",
         "packages/drafter/src/RefractElementFactory.h",
         "packages/drafter/src/RefractElementFactory.cc",
+        "packages/drafter/src/ConversionBudget.cc",
+        "packages/drafter/src/ConversionBudget.h",
         "packages/drafter/src/ConversionContext.cc",
         "packages/drafter/src/ConversionContext.h",
+        "packages/drafter/src/ParseCache.h",
+        "packages/drafter/src/ParseCache.cc",
+        "packages/drafter/src/ParseProgress.h",
+        "packages/drafter/src/ParseProgress.cc",
+        "packages/drafter/src/MediaTypeTable.h",
+        "packages/drafter/src/MediaTypeTable.cc",
         "packages/drafter/src/ElementInfoUtils.h",
         "packages/drafter/src/ElementComparator.h",
 
@@ -313,6 +321,8 @@
 
         "packages/drafter/src/utils/Utf8.h",
         "packages/drafter/src/utils/Utils.h",
+        "packages/drafter/src/utils/Sha256.h",
+        "packages/drafter/src/utils/Sha256.cc",
         "packages/drafter/src/utils/so/Value.h",
         "packages/drafter/src/utils/so/Value.cc",
         "packages/drafter/src/utils/so/JsonIo.h",
@@ -340,8 +350,6 @@
 
         "packages/drafter/src/refract/ComparableVisitor.h",
         "packages/drafter/src/refract/ComparableVisitor.cc",
-        "packages/drafter/src/refract/IsExpandableVisitor.h",
-        "packages/drafter/src/refract/IsExpandableVisitor.cc",
         "packages/drafter/src/refract/ExpandVisitor.h",
         "packages/drafter/src/refract/ExpandVisitor.cc",
         "packages/drafter/src/refract/PrintVisitor.h",
@@ -355,11 +363,17 @@
         "packages/drafter/src/refract/JsonUtils.cc",
         "packages/drafter/src/refract/ElementUtils.h",
         "packages/drafter/src/refract/ElementUtils.cc",
+        "packages/drafter/src/refract/ElementTraits.h",
+        "packages/drafter/src/refract/ElementTraits.cc",
+        "packages/drafter/src/refract/GenerationContext.h",
+        "packages/drafter/src/refract/GenerationContext.cc",
         "packages/drafter/src/refract/ElementSize.h",
         "packages/drafter/src/refract/ElementSize.cc",
         "packages/drafter/src/refract/Cardinal.h",
         "packages/drafter/src/refract/SerializeSo.h",
         "packages/drafter/src/refract/SerializeSo.cc",
+        "packages/drafter/src/refract/SerializeCbor.h",
+        "packages/drafter/src/refract/SerializeCbor.cc",
 
         "packages/drafter/src/refract/Registry.h",
         "packages/drafter/src/refract/Registry.cc",
@@ -493,6 +507,8 @@
         "packages/drafter/src/config.h",
         "packages/drafter/src/reporting.cc",
         "packages/drafter/src/reporting.h",
+        "packages/drafter/src/input.cc",
+        "packages/drafter/src/input.h",
       ],
       "include_dirs": [
         "packages/cmdline",
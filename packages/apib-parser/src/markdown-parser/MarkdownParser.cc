@@ -31,7 +31,27 @@ static ByteBuffer ByteBufferFromSundown(const struct buf* text)
     return ByteBuffer(reinterpret_cast<char*>(text->data), text->size);
 }
 
-MarkdownParser::MarkdownParser() : m_workingNode(NULL), m_listBlockContext(false), m_source(NULL), m_sourceLength(0) {}
+MarkdownParser::MarkdownParser()
+    : m_workingNode(NULL), m_listBlockContext(false), m_source(NULL), m_sourceLength(0), m_renderer(NULL), m_output(NULL)
+{
+}
+
+MarkdownParser::~MarkdownParser()
+{
+    releaseRenderer();
+}
+
+void MarkdownParser::releaseRenderer()
+{
+    if (m_output)
+        ::bufrelease(m_output);
+
+    if (m_renderer)
+        ::sd_markdown_free(m_renderer);
+
+    m_output = NULL;
+    m_renderer = NULL;
+}
 
 void MarkdownParser::parse(const ByteBuffer& source, MarkdownNode& ast)
 {
@@ -43,15 +63,24 @@ void MarkdownParser::parse(const ByteBuffer& source, MarkdownNode& ast)
     m_sourceLength = source.length();
     m_listBlockContext = false;
 
-    RenderCallbacks callbacks = renderCallbacks();
-
-    ::sd_markdown* sundown = ::sd_markdown_new(ParserExtensions, MaxNesting, &callbacks, renderCallbackData());
-    ::buf* output = ::bufnew(OutputUnitSize);
-
-    ::sd_markdown_render(output, reinterpret_cast<const uint8_t*>(source.c_str()), source.length(), sundown);
+    if (!m_renderer) {
+        RenderCallbacks callbacks = renderCallbacks();
+        m_renderer = ::sd_markdown_new(ParserExtensions, MaxNesting, &callbacks, renderCallbackData());
+        m_output = ::bufnew(OutputUnitSize);
+    }
 
-    ::bufrelease(output);
-    ::sd_markdown_free(sundown);
+    // Callbacks render nothing, the output is kept empty
+    m_output->size = 0;
+
+    try {
+        ::sd_markdown_render(m_output, reinterpret_cast<const uint8_t*>(source.c_str()), source.length(), m_renderer);
+    } catch (...) {
+        // An interrupted render leaves the renderer's work buffers in use
+        releaseRenderer();
+        m_workingNode = NULL;
+        m_source = NULL;
+        throw;
+    }
 
     m_workingNode = NULL;
     m_source = NULL;
@@ -27,11 +27,15 @@ namespace mdp
 
     /**
      *  GitHub-flavored Markdown Parser
+     *
+     *  The sundown renderer and its buffers are created on first use and
+     *  kept for the following parses.
      */
     class MarkdownParser
     {
     public:
         MarkdownParser();
+        ~MarkdownParser();
         MarkdownParser(const MarkdownParser&);
         MarkdownParser& operator=(const MarkdownParser&);
 
@@ -49,6 +53,11 @@ namespace mdp
         const ByteBuffer* m_source;
         size_t m_sourceLength;
 
+        ::sd_markdown* m_renderer;
+        ::buf* m_output;
+
+        void releaseRenderer();
+
         static const size_t OutputUnitSize;
         static const size_t MaxNesting;
         static const int ParserExtensions;
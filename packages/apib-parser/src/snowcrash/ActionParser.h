@@ -98,8 +98,7 @@ namespace snowcrash
             MarkdownNodeIterator cur = node;
             std::stringstream ss;
 
-            mdp::CharactersRangeSet sourceMap
-                = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+            SourceBytesLocation sourceMap(node->sourceMap);
 
             switch (sectionType) {
                 case RelationSectionType: {
@@ -188,7 +187,7 @@ namespace snowcrash
         static bool isUnexpectedNode(const MarkdownNodeIterator& node, SectionType sectionType)
         {
 
-            if (SectionProcessor<Asset>::sectionType(node) != UndefinedSectionType) {
+            if (CachedSectionType<Asset>(node) != UndefinedSectionType) {
                 return true;
             }
 
@@ -232,14 +231,13 @@ namespace snowcrash
                 return ++MarkdownNodeIterator(node);
             }
 
-            SectionType assetType = SectionProcessor<Asset>::sectionType(node);
+            SectionType assetType = CachedSectionType<Asset>(node);
 
             if (assetType != UndefinedSectionType) {
 
                 // WARN: Ignoring section
                 std::stringstream ss;
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
 
                 ss << "Ignoring " << SectionName(assetType) << " list item, ";
                 ss << SectionName(assetType) << " list item is expected to be indented by 4 spaces or 1 tab";
@@ -275,35 +273,35 @@ namespace snowcrash
             SectionType nestedType = UndefinedSectionType;
 
             // Check if relation section
-            nestedType = SectionProcessor<Relation>::sectionType(node);
+            nestedType = CachedSectionType<Relation>(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if parameters section
-            nestedType = SectionProcessor<Parameters>::sectionType(node);
+            nestedType = CachedSectionType<Parameters>(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if headers section
-            nestedType = SectionProcessor<Headers>::sectionType(node);
+            nestedType = CachedSectionType<Headers>(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if attributes section
-            nestedType = SectionProcessor<Attributes>::sectionType(node);
+            nestedType = CachedSectionType<Attributes>(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if payload section
-            nestedType = SectionProcessor<Payload>::sectionType(node);
+            nestedType = CachedSectionType<Payload>(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
@@ -338,8 +336,7 @@ namespace snowcrash
             if (out.node.examples.empty()) {
 
                 // WARN: No response for action
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.warnings.push_back(
                     Warning("action is missing a response", EmptyDefinitionWarning, sourceMap));
             } else if (!out.node.examples.empty() && !out.node.examples.back().requests.empty()
@@ -355,8 +352,7 @@ namespace snowcrash
                     ss << "the '" << out.node.examples.back().requests.back().name << "' request";
                 }
 
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.warnings.push_back(Warning(ss.str(), EmptyDefinitionWarning, sourceMap));
             }
         }
@@ -370,7 +366,7 @@ namespace snowcrash
          *  \param  report      Parser report.
          */
         static void checkPayload(SectionType sectionType,
-            const mdp::CharactersRangeSet sourceMap,
+            const SourceBytesLocation& sourceMap,
             const Payload& payload,
             const ParseResultRef<Action>& out)
         {
@@ -454,8 +450,7 @@ namespace snowcrash
             ss << "the 'headers' section at this level is deprecated and will be removed in a future, use respective "
                   "payload header section(s) instead";
 
-            mdp::CharactersRangeSet sourceMap
-                = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+            SourceBytesLocation sourceMap(node->sourceMap);
             out.report.warnings.push_back(Warning(ss.str(), DeprecatedWarning, sourceMap));
 
             return cur;
@@ -536,8 +531,7 @@ namespace snowcrash
 
             if (RegexMatch(node->text, NamedActionNonAbsoluteURIRegex)) {
                 std::stringstream ss;
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
 
                 ss << "URI path in '" << node->text << "' is not absolute, it should have a leading forward slash";
 
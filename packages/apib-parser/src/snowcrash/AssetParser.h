@@ -111,10 +111,12 @@ namespace snowcrash
             subject = GetFirstLine(subject, remaining);
             TrimString(subject);
 
-            if (RegexMatch(subject, BodyRegex))
+            const SignatureKeyword keyword = RecognizeSignatureKeyword(subject);
+
+            if (keyword == BodySignatureKeyword)
                 return BodyAssetSignature;
 
-            if (RegexMatch(subject, SchemaRegex))
+            if (keyword == SchemaSignatureKeyword)
                 return SchemaAssetSignature;
 
             return NoAssetSignature;
@@ -100,7 +100,7 @@ namespace snowcrash
                 subject = GetFirstLine(subject, remaining);
                 TrimString(subject);
 
-                if (RegexMatch(subject, AttributesRegex)) {
+                if (RecognizeSignatureKeyword(subject) == AttributesSignatureKeyword) {
                     return AttributesSectionType;
                 }
             }
@@ -111,7 +111,7 @@ namespace snowcrash
         static SectionType nestedSectionType(const MarkdownNodeIterator& node)
         {
 
-            return SectionProcessor<mson::ValueMember>::nestedSectionType(node);
+            return CachedNestedSectionType<mson::ValueMember>(node);
         }
     };
 
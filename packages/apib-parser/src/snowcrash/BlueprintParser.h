@@ -11,6 +11,12 @@
 
 #include <iterator>
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <system_error>
+#include <thread>
+#include <unordered_set>
 #include "ResourceParser.h"
 #include "ResourceGroupParser.h"
 #include "DataStructureGroupParser.h"
@@ -99,6 +105,8 @@ namespace snowcrash
             const ParseResultRef<Blueprint>& out)
         {
 
+            pd.checkpoint(*node);
+
             MarkdownNodeIterator cur = node;
 
             if (pd.sectionContext() == ResourceGroupSectionType) {
@@ -119,8 +127,7 @@ namespace snowcrash
 
                     ss << " is already defined";
 
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                    SourceBytesLocation sourceMap(node->sourceMap);
                     out.report.warnings.push_back(Warning(ss.str(), DuplicateWarning, sourceMap));
                 }
 
@@ -196,7 +203,7 @@ namespace snowcrash
                         contextSectionType = sectionType;
                         contextCur = cur;
                     } else if (contextSectionType != DataStructureGroupSectionType
-                        && SectionProcessor<Action>::sectionType(cur) == ActionSectionType) {
+                        && CachedSectionType<Action>(cur) == ActionSectionType) {
 
                         contextSectionType = UndefinedSectionType;
                     }
@@ -235,6 +242,328 @@ namespace snowcrash
             resolveNamedTypeTables(pd, out.report);
         }
 
+        /** Range of nested sections parsed concurrently */
+        struct NestedSectionRange {
+
+            /** First node of the range */
+            MarkdownNodeIterator begin;
+
+            /** Node the next range starts at */
+            MarkdownNodes::const_iterator end;
+
+            /** Node the parsing of the range stopped at */
+            MarkdownNodeIterator parsedEnd;
+
+            /** Sections of the range, parsed as a blueprint of their own */
+            ParseResult<Blueprint> result;
+
+            /** Lookups of the state the preceding ranges change */
+            SharedStateLog log;
+
+            /** Parser data of the range */
+            std::unique_ptr<SectionParserData> pd;
+
+            /** Exception the parsing has thrown */
+            std::exception_ptr exception;
+        };
+
+        /** Names the duplicate checks look up in the nested sections parsed before */
+        struct NestedSectionNames {
+            std::unordered_set<mdp::ByteBuffer> groups;
+            std::unordered_set<URITemplate> resources;
+            std::unordered_set<mdp::ByteBuffer> namedTypes;
+        };
+
+        /**
+         * Split the nested sections into ranges of about the same size of source, parse them
+         * concurrently and join them in document order.
+         *
+         * Ranges start at group headers and begin with a copy of the parser data as it is after
+         * the pre-process, named types are known by then. Whatever else a range shares with the
+         * preceding ones is recorded and checked once all are parsed: dependencies between named
+         * types, models, and names of groups, resources and named types looked up for duplicates.
+         * If any range would have been parsed differently after the preceding ones, or did not end
+         * where the next one starts, none is used and the sections are parsed sequentially.
+         */
+        static MarkdownNodeIterator parseNestedSectionsConcurrently(const MarkdownNodeIterator& node,
+            const MarkdownNodes& siblings,
+            SectionParserData& pd,
+            const ParseResultRef<Blueprint>& out)
+        {
+
+            // A pre-process error may change how the sections are parsed
+            if (pd.concurrency < 2 || out.report.error.code != Error::OK) {
+                return node;
+            }
+
+            std::vector<MarkdownNodeIterator> starts = splitNestedSections(node, siblings, pd);
+
+            if (starts.size() < 2) {
+                return node;
+            }
+
+            std::vector<NestedSectionRange> ranges(starts.size());
+
+            for (size_t i = 0; i < ranges.size(); ++i) {
+                ranges[i].begin = starts[i];
+                ranges[i].end = (i + 1 < starts.size()) ? starts[i + 1] : siblings.end();
+            }
+
+            std::atomic<size_t> next{ 0 };
+
+            auto parseRanges = [&]() {
+                for (size_t i = next++; i < ranges.size(); i = next++) {
+                    NestedSectionRange& range = ranges[i];
+
+                    try {
+                        range.pd.reset(new SectionParserData(pd, range.result.node, range.log));
+                        range.parsedEnd = SectionParser<Blueprint, BlueprintSectionAdapter>::parseNestedSectionsUntil(
+                            range.begin, range.end, siblings, *range.pd, range.result);
+                    } catch (...) {
+                        range.exception = std::current_exception();
+                    }
+                }
+            };
+
+            std::vector<std::thread> workers;
+
+            for (size_t i = 1; i < ranges.size(); ++i) {
+                try {
+                    workers.emplace_back([&parseRanges]() {
+                        SectionTypeCache sectionTypes;
+                        SectionTypeCache::Scope scope(sectionTypes);
+                        parseRanges();
+                    });
+                } catch (const std::system_error&) {
+                    break; // parse with the threads there are
+                }
+            }
+
+            parseRanges();
+
+            for (auto& worker : workers) {
+                worker.join();
+            }
+
+            if (!joinNestedSectionRanges(ranges, pd, out)) {
+                return node;
+            }
+
+            return ranges.back().parsedEnd;
+        }
+
+        /**
+         * \brief Split nested sections at group headers into at most as many ranges as there are threads
+         *
+         * \return First node of each range
+         */
+        static std::vector<MarkdownNodeIterator> splitNestedSections(
+            const MarkdownNodeIterator& node, const MarkdownNodes& siblings, const SectionParserData& pd)
+        {
+
+            std::vector<MarkdownNodeIterator> starts(1, node);
+
+            if (node == siblings.end() || node->sourceMap.empty()
+                || node->sourceMap.front().location >= pd.sourceData.size()) {
+                return starts;
+            }
+
+            const size_t first = node->sourceMap.front().location;
+            const size_t size = pd.sourceData.size() - first;
+
+            for (MarkdownNodeIterator cur = std::next(node); cur != siblings.end(); ++cur) {
+
+                if (cur->type != mdp::HeaderMarkdownNodeType || cur->sourceMap.empty()) {
+                    continue;
+                }
+
+                SectionType nestedType = CachedNestedSectionType<Blueprint>(cur);
+
+                if (nestedType != ResourceGroupSectionType && nestedType != DataStructureGroupSectionType) {
+                    continue;
+                }
+
+                // Start the next range once the current one has its share of the source
+                if ((cur->sourceMap.front().location - first) * pd.concurrency >= size * starts.size()) {
+                    starts.push_back(cur);
+
+                    if (starts.size() == pd.concurrency) {
+                        break;
+                    }
+                }
+            }
+
+            return starts;
+        }
+
+        /**
+         * \brief Join the ranges of nested sections in document order
+         *
+         * Nothing is joined unless every range was parsed as it would have been after the preceding ones.
+         *
+         * \return True if the ranges were joined
+         */
+        static bool joinNestedSectionRanges(
+            std::vector<NestedSectionRange>& ranges, SectionParserData& pd, const ParseResultRef<Blueprint>& out)
+        {
+
+            mson::NamedTypeDependencyTable dependencies(pd.namedTypeDependencyTable);
+            std::unordered_set<mdp::ByteBuffer> models;
+            NestedSectionNames names;
+
+            addNestedSectionNames(out.node.content.elements(), names);
+
+            for (const auto& range : ranges) {
+
+                // An error may change how the following sections are parsed
+                if (range.exception || range.parsedEnd != range.end || range.result.report.error.code != Error::OK) {
+                    return false;
+                }
+
+                // Replay the dependencies as they would have been added after the preceding ranges
+                for (const auto& dependency : range.log.dependencies) {
+
+                    const bool added = dependencies.contains(dependency.dependency)
+                        && !(dependency.circularCheck
+                               && (dependency.dependent == dependency.dependency
+                                      || dependencies.dependsOn(dependency.dependency, dependency.dependent)));
+
+                    if (added != dependency.added) {
+                        return false;
+                    }
+
+                    if (added) {
+                        dependencies.addDependency(dependency.dependent, dependency.dependency);
+                    }
+                }
+
+                // Models of the preceding ranges would have been found
+                for (const auto& name : range.log.modelMisses) {
+                    if (models.count(name)) {
+                        return false;
+                    }
+                }
+
+                for (const auto& model : range.pd->modelTable) {
+                    if (pd.modelTable.find(model.first) == pd.modelTable.end() && !models.insert(model.first).second) {
+                        return false;
+                    }
+                }
+
+                if (isNestedSectionNameDuplicate(range.result.node.content.elements(), names)) {
+                    return false;
+                }
+
+                addNestedSectionNames(range.result.node.content.elements(), names);
+            }
+
+            pd.namedTypeDependencyTable = std::move(dependencies);
+
+            for (auto& range : ranges) {
+
+                Report& report = range.result.report;
+                out.report.warnings.insert(out.report.warnings.end(), report.warnings.begin(), report.warnings.end());
+
+                Elements& elements = range.result.node.content.elements();
+                out.node.content.elements().insert(out.node.content.elements().end(),
+                    std::make_move_iterator(elements.begin()),
+                    std::make_move_iterator(elements.end()));
+
+                if (pd.exportSourceMap()) {
+
+                    auto& elementsSM = range.result.sourceMap.content.elements().collection;
+                    out.sourceMap.content.elements().collection.insert(out.sourceMap.content.elements().collection.end(),
+                        std::make_move_iterator(elementsSM.begin()),
+                        std::make_move_iterator(elementsSM.end()));
+                }
+
+                pd.modelTable.insert(range.pd->modelTable.begin(), range.pd->modelTable.end());
+                pd.modelSourceMapTable.insert(range.pd->modelSourceMapTable.begin(), range.pd->modelSourceMapTable.end());
+            }
+
+            return true;
+        }
+
+        /** \return True if the duplicate check of a resource would find it among the names */
+        static bool isNestedSectionNameDuplicate(const Resource& resource, const NestedSectionNames& names)
+        {
+
+            if (names.resources.count(resource.uriTemplate)) {
+                return true;
+            }
+
+            // Resources keep the attributes of their named type unless it is a duplicate
+            return !resource.name.empty() && resource.attributes.name.symbol.literal == resource.name
+                && names.namedTypes.count(resource.name);
+        }
+
+        /** \return True if the duplicate checks of the elements would find any of them among the names */
+        static bool isNestedSectionNameDuplicate(const Elements& elements, const NestedSectionNames& names)
+        {
+
+            for (const auto& element : elements) {
+
+                if (element.element == Element::ResourceElement
+                    && isNestedSectionNameDuplicate(element.content.resource, names)) {
+                    return true;
+                }
+
+                if (element.element != Element::CategoryElement) {
+                    continue;
+                }
+
+                if (element.category == Element::ResourceGroupCategory && names.groups.count(element.attributes.name)) {
+                    return true;
+                }
+
+                for (const auto& child : element.content.elements()) {
+
+                    if (child.element == Element::ResourceElement
+                        && isNestedSectionNameDuplicate(child.content.resource, names)) {
+                        return true;
+                    }
+
+                    if (child.element == Element::DataStructureElement
+                        && names.namedTypes.count(child.content.dataStructure.name.symbol.literal)) {
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        /** Add the names the duplicate checks look up in the elements */
+        static void addNestedSectionNames(const Elements& elements, NestedSectionNames& names)
+        {
+
+            for (const auto& element : elements) {
+
+                if (element.element == Element::ResourceElement) {
+                    names.resources.insert(element.content.resource.uriTemplate);
+                    names.namedTypes.insert(element.content.resource.attributes.name.symbol.literal);
+                }
+
+                if (element.element != Element::CategoryElement) {
+                    continue;
+                }
+
+                if (element.category == Element::ResourceGroupCategory) {
+                    names.groups.insert(element.attributes.name);
+                }
+
+                for (const auto& child : element.content.elements()) {
+
+                    if (child.element == Element::ResourceElement) {
+                        names.resources.insert(child.content.resource.uriTemplate);
+                        names.namedTypes.insert(child.content.resource.attributes.name.symbol.literal);
+                    } else if (child.element == Element::DataStructureElement) {
+                        names.namedTypes.insert(child.content.dataStructure.name.symbol.literal);
+                    }
+                }
+            }
+        }
+
         static void checkForPossibleSectionMistakes(
             const MarkdownNodeIterator& node, SectionParserData& pd, Report& report)
         {
@@ -254,21 +583,21 @@ namespace snowcrash
             SectionType nestedType = UndefinedSectionType;
 
             // Check if Resource section
-            nestedType = SectionProcessor<Resource>::sectionType(node);
+            nestedType = CachedSectionType<Resource>(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if ResourceGroup section
-            nestedType = SectionProcessor<ResourceGroup>::sectionType(node);
+            nestedType = CachedSectionType<ResourceGroup>(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if DataStructures section
-            nestedType = SectionProcessor<DataStructureGroup>::sectionType(node);
+            nestedType = CachedSectionType<DataStructureGroup>(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
@@ -294,15 +623,13 @@ namespace snowcrash
             if (pd.options & RequireBlueprintNameOption) {
 
                 // ERR: No API name specified
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.error = Error(ExpectedAPINameMessage, BusinessError, sourceMap);
 
             } else if (!out.node.description.empty()) {
 
                 // WARN: No API name specified
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.warnings.push_back(Warning(ExpectedAPINameMessage, APINameWarning, sourceMap));
             }
         }
@@ -354,14 +681,13 @@ namespace snowcrash
             }
 
             // If named type already exists, return error
-            if (pd.namedTypeDependencyTable.find(identifier) != pd.namedTypeDependencyTable.end()) {
+            if (pd.namedTypeDependencyTable.contains(identifier)) {
 
                 // ERR: Named type is defined more than once
                 std::stringstream ss;
                 ss << "named type '" << identifier << "' is defined more than once";
 
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 report.error = Error(ss.str(), MSONError, sourceMap);
                 return;
             }
@@ -369,7 +695,7 @@ namespace snowcrash
             mson::BaseTypeName baseTypeName = typeDefinition.typeSpecification.name.base;
 
             // Initialize an entry in the dependency table
-            pd.namedTypeDependencyTable[identifier] = std::set<mson::Literal>();
+            pd.namedTypeDependencyTable.declare(identifier);
 
             // Add the respective entries to the tables
             if (baseTypeName != mson::UndefinedTypeName) {
@@ -380,7 +706,7 @@ namespace snowcrash
 
                     for (const auto& nestedType : typeDefinition.typeSpecification.nestedTypes) {
                         if (!nestedType.symbol.literal.empty() && !nestedType.symbol.variable) {
-                            pd.namedTypeDependencyTable[identifier].insert(nestedType.symbol.literal);
+                            pd.namedTypeDependencyTable.addPendingDependency(identifier, nestedType.symbol.literal);
                         }
                     }
                 }
@@ -391,7 +717,8 @@ namespace snowcrash
                     = std::make_pair(typeDefinition.typeSpecification.name.symbol.literal, node->sourceMap);
 
                 // Make the sub type dependent on super type
-                pd.namedTypeDependencyTable[identifier].insert(typeDefinition.typeSpecification.name.symbol.literal);
+                pd.namedTypeDependencyTable.addPendingDependency(
+                    identifier, typeDefinition.typeSpecification.name.symbol.literal);
             } else if (typeDefinition.typeSpecification.name.empty()) {
 
                 // If there is no specification, an object is assumed
@@ -408,9 +735,7 @@ namespace snowcrash
         static void resolveNamedTypeTables(SectionParserData& pd, Report& report)
         {
             // First resolve dependency tables
-            for (const auto& dependency : pd.namedTypeDependencyTable) {
-                resolveNamedTypeDependencyTableEntry(pd, dependency.first, report);
-            }
+            pd.namedTypeDependencyTable.resolve();
 
             for (const auto& base : pd.namedTypeInheritanceTable) {
                 resolveNamedTypeBaseTableEntry(pd, base.first, base.second.first, base.second.second, report);
@@ -421,41 +746,6 @@ namespace snowcrash
             }
         }
 
-        /**
-         * \brief Resolve the inheritance dependencies of the current named type
-         *        (Does not include mixin or member dependencies)
-         *
-         * \param pd Section parser data
-         * \param identifier The named type whose dependents need to be resolved
-         * \param report Parse report
-         */
-        static void resolveNamedTypeDependencyTableEntry(
-            SectionParserData& pd, const mson::Literal& identifier, Report& report)
-        {
-
-            std::set<mson::Literal> diffDeps, finalDeps, initialDeps;
-
-            do {
-                initialDeps = pd.namedTypeDependencyTable[identifier];
-                diffDeps.clear();
-
-                for (std::set<mson::Literal>::iterator it = initialDeps.begin(); it != initialDeps.end(); it++) {
-
-                    std::set<mson::Literal> superTypeDeps = pd.namedTypeDependencyTable[*it];
-                    pd.namedTypeDependencyTable[identifier].insert(superTypeDeps.begin(), superTypeDeps.end());
-                }
-
-                // Check if the list of dependents has grown
-                finalDeps = pd.namedTypeDependencyTable[identifier];
-                std::set_difference(finalDeps.begin(),
-                    finalDeps.end(),
-                    initialDeps.begin(),
-                    initialDeps.end(),
-                    std::inserter(diffDeps, diffDeps.end()));
-
-            } while (!diffDeps.empty());
-        };
-
         /**
          * \brief For each entry in the named type inheritance table, resolve the sub-type's base type recursively
          *
@@ -480,16 +770,13 @@ namespace snowcrash
             }
 
             // Check for circular references
-            std::set<mson::Literal> deps = pd.namedTypeDependencyTable[subType];
-
-            if (deps.find(subType) != deps.end()) {
+            if (pd.namedTypeDependencyTable.isCircular(subType)) {
 
                 // ERR: A named type is circularly referenced
                 std::stringstream ss;
                 ss << "base type '" << subType << "' circularly referencing itself";
 
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(nodeSourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(nodeSourceMap);
                 report.error = Error(ss.str(), MSONError, sourceMap);
                 return;
             }
@@ -511,8 +798,7 @@ namespace snowcrash
                     std::stringstream ss;
                     ss << "base type '" << superType << "' is not defined in the document";
 
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(nodeSourceMap, pd.sourceCharacterIndex);
+                    SourceBytesLocation sourceMap(nodeSourceMap);
                     report.error = Error(ss.str(), MSONError, sourceMap);
                     return;
                 }
@@ -579,16 +865,14 @@ namespace snowcrash
                         std::stringstream ss;
                         ss << "duplicate definition of '" << it->first << "'";
 
-                        mdp::CharactersRangeSet sourceMap
-                            = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                        SourceBytesLocation sourceMap(node->sourceMap);
                         out.report.warnings.push_back(Warning(ss.str(), DuplicateWarning, sourceMap));
                     }
                 }
             } else if (!out.node.empty()) {
 
                 // WARN: malformed metadata block
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.warnings.push_back(
                     Warning("ignoring possible metadata, expected '<key> : <value>', one one per line",
                         FormattingWarning,
@@ -826,8 +1110,7 @@ namespace snowcrash
                 std::stringstream ss;
                 ss << "Undefined resource model " << out.node.reference.id;
 
-                mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(
-                    out.node.reference.meta.node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(out.node.reference.meta.node->sourceMap);
                 out.report.error = Error(ss.str(), ModelError, sourceMap);
 
                 out.node.reference.meta.state = Reference::StateUnresolved;
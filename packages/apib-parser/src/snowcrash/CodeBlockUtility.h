@@ -76,7 +76,7 @@ namespace snowcrash
             ss << level * 4 << " spaces or " << level << " tabs";
 
             mdp::CharactersRangeSet sourceMap
-                = mdp::BytesRangeSetToConsecutiveCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                = mdp::BytesRangeSetToConsecutiveCharactersRangeSet(node->sourceMap, pd.characterIndex);
             report.warnings.push_back(Warning(ss.str(), IndentationWarning, sourceMap));
         }
 
@@ -108,8 +108,7 @@ namespace snowcrash
             ss << "indent every of its line by ";
             ss << level * 4 << " spaces or " << level << " tabs";
 
-            mdp::CharactersRangeSet sourceMap
-                = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+            SourceBytesLocation sourceMap(node->sourceMap);
             report.warnings.push_back(Warning(ss.str(), IndentationWarning, sourceMap));
         }
 
@@ -157,8 +156,7 @@ namespace snowcrash
                     ss << "section is not expected to be indented";
                 }
 
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 report.warnings.push_back(Warning(ss.str(), IndentationWarning, sourceMap));
             }
 
@@ -222,8 +220,7 @@ namespace snowcrash
                 ss << "dangling message-body asset, expected a pre-formatted code block, ";
                 ss << "indent every of it's line by " << level * 4 << " spaces or " << level << " tabs";
 
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 report.warnings.push_back(Warning(ss.str(), IndentationWarning, sourceMap));
             }
 
@@ -250,8 +247,7 @@ namespace snowcrash
                 ss << "a reference must be directly in the " << SectionName(pd.sectionContext())
                    << " section, indented by 4 spaces or 1 tab, without any additional sections";
 
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 report.warnings.push_back(Warning(ss.str(), IgnoringWarning, sourceMap));
 
                 return true;
@@ -46,8 +46,7 @@ namespace snowcrash
                     std::stringstream ss;
                     ss << "named type with name '" << namedType.node.name.symbol.literal << "' already exists";
 
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                    SourceBytesLocation sourceMap(node->sourceMap);
                     out.report.warnings.push_back(Warning(ss.str(), DuplicateWarning, sourceMap));
                     return cur;
                 }
@@ -96,7 +95,7 @@ namespace snowcrash
                 subject = GetFirstLine(subject, remaining);
                 TrimString(subject);
 
-                if (RegexMatch(subject, DataStructureGroupRegex)) {
+                if (RecognizeSignatureKeyword(subject) == DataStructuresSignatureKeyword) {
                     return DataStructureGroupSectionType;
                 }
             }
@@ -107,7 +106,7 @@ namespace snowcrash
         static SectionType nestedSectionType(const MarkdownNodeIterator& node)
         {
 
-            return SectionProcessor<mson::NamedType>::sectionType(node);
+            return CachedSectionType<mson::NamedType>(node);
         }
 
         static SectionTypes upperSectionTypes()
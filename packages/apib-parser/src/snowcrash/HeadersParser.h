@@ -165,7 +165,7 @@ namespace snowcrash
                 signature = GetFirstLine(subject, remainingContent);
                 TrimString(signature);
 
-                if (RegexMatch(signature, HeadersRegex))
+                if (RecognizeSignatureKeyword(signature) == HeadersSignatureKeyword)
                     return HeadersSectionType;
             }
 
@@ -179,8 +179,7 @@ namespace snowcrash
             if (out.node.empty()) {
 
                 // WARN: No valid headers defined
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.warnings.push_back(Warning("no valid headers specified", FormattingWarning, sourceMap));
             }
         }
@@ -291,7 +290,7 @@ namespace snowcrash
                 mdp::BytesRangeSet byteMap;
                 byteMap.push_back(map);
                 mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(byteMap, pd.sourceCharacterIndex);
+                    = mdp::BytesRangeSetToCharactersRangeSet(byteMap, pd.characterIndex);
 
                 if (parseHeaderLine(line, header, out, sourceMap)) {
                     out.node.push_back(header);
@@ -8,6 +8,9 @@
 
 #include "MSON.h"
 
+#include <algorithm>
+#include <utility>
+
 using namespace mson;
 
 bool Value::empty() const
@@ -105,3 +108,164 @@ bool PropertyMember::empty() const
 {
     return (this->name.empty() && this->description.empty() && this->sections.empty() && this->valueDefinition.empty());
 }
+
+void NamedTypeDependencyTable::declare(const Literal& identifier)
+{
+    m_nodes[intern(identifier)].known = true;
+}
+
+bool NamedTypeDependencyTable::contains(const Literal& identifier) const
+{
+    auto it = m_ids.find(identifier);
+    return it != m_ids.end() && m_nodes[it->second].known;
+}
+
+void NamedTypeDependencyTable::addDependency(const Literal& dependent, const Literal& dependency)
+{
+    const Id from = intern(dependent);
+    const Id to = intern(dependency);
+
+    m_nodes[from].known = true;
+    addEdge(from, to);
+}
+
+void NamedTypeDependencyTable::addPendingDependency(const Literal& dependent, const Literal& dependency)
+{
+    const Id from = intern(dependent);
+    addEdge(from, intern(dependency));
+}
+
+void NamedTypeDependencyTable::resolve()
+{
+    for (const auto& node : m_nodes) {
+        if (node.known) {
+            for (Id dependency : node.dependencies)
+                m_nodes[dependency].known = true;
+        }
+    }
+
+    // Tarjan's algorithm, iterative so that long inheritance chains cannot exhaust the stack
+    const Id unvisited = m_nodes.size();
+
+    std::vector<Id> index(m_nodes.size(), unvisited);
+    std::vector<Id> lowlink(m_nodes.size(), 0);
+    std::vector<bool> onStack(m_nodes.size(), false);
+    std::vector<Id> stack;
+    std::vector<std::pair<Id, Id> > calls; // node and its next dependency to visit
+    Id counter = 0;
+
+    for (Id root = 0; root < m_nodes.size(); ++root) {
+        if (index[root] != unvisited)
+            continue;
+
+        calls.emplace_back(root, 0);
+
+        while (!calls.empty()) {
+            const Id v = calls.back().first;
+            Id& next = calls.back().second;
+
+            if (next == 0) {
+                index[v] = lowlink[v] = counter++;
+                stack.push_back(v);
+                onStack[v] = true;
+            }
+
+            if (next < m_nodes[v].dependencies.size()) {
+                const Id w = m_nodes[v].dependencies[next++];
+
+                if (w == v) {
+                    m_nodes[v].circular = true;
+                } else if (index[w] == unvisited) {
+                    calls.emplace_back(w, 0);
+                } else if (onStack[w]) {
+                    lowlink[v] = std::min(lowlink[v], index[w]);
+                }
+
+                continue;
+            }
+
+            calls.pop_back();
+
+            if (!calls.empty()) {
+                const Id parent = calls.back().first;
+                lowlink[parent] = std::min(lowlink[parent], lowlink[v]);
+            }
+
+            if (lowlink[v] != index[v])
+                continue;
+
+            // v is the root of a component, every member of a larger one is circular
+            const auto first = std::find(stack.rbegin(), stack.rend(), v).base() - 1;
+            const bool cycle = stack.end() - first > 1;
+
+            for (auto it = first; it != stack.end(); ++it) {
+                onStack[*it] = false;
+                if (cycle)
+                    m_nodes[*it].circular = true;
+            }
+
+            stack.erase(first, stack.end());
+        }
+    }
+}
+
+bool NamedTypeDependencyTable::isCircular(const Literal& identifier) const
+{
+    auto it = m_ids.find(identifier);
+    return it != m_ids.end() && m_nodes[it->second].circular;
+}
+
+bool NamedTypeDependencyTable::dependsOn(const Literal& dependent, const Literal& dependency) const
+{
+    auto from = m_ids.find(dependent);
+    auto to = m_ids.find(dependency);
+
+    if (from == m_ids.end() || to == m_ids.end())
+        return false;
+
+    if (m_visited.size() < m_nodes.size())
+        m_visited.resize(m_nodes.size(), 0);
+
+    if (++m_visitStamp == 0) {
+        std::fill(m_visited.begin(), m_visited.end(), 0);
+        m_visitStamp = 1;
+    }
+
+    // only the part of the graph reachable from the dependent is visited
+    std::vector<Id> pending(1, from->second);
+
+    while (!pending.empty()) {
+        const Id v = pending.back();
+        pending.pop_back();
+
+        for (Id w : m_nodes[v].dependencies) {
+            if (w == to->second)
+                return true;
+
+            if (m_visited[w] != m_visitStamp) {
+                m_visited[w] = m_visitStamp;
+                pending.push_back(w);
+            }
+        }
+    }
+
+    return false;
+}
+
+NamedTypeDependencyTable::Id NamedTypeDependencyTable::intern(const Literal& identifier)
+{
+    auto inserted = m_ids.emplace(identifier, m_nodes.size());
+
+    if (inserted.second)
+        m_nodes.emplace_back();
+
+    return inserted.first->second;
+}
+
+void NamedTypeDependencyTable::addEdge(Id dependent, Id dependency)
+{
+    const unsigned long long key = (static_cast<unsigned long long>(dependent) << 32) ^ dependency;
+
+    if (m_edges.insert(key).second)
+        m_nodes[dependent].dependencies.push_back(dependency);
+}
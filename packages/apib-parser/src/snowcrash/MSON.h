@@ -13,6 +13,8 @@
 #include <string>
 #include <set>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 #include <mpark/variant.hpp>
 #include <boost/container/vector.hpp>
 #include <stdexcept>
@@ -61,8 +63,60 @@ namespace mson
     /** Named Types inheritance table */
     typedef std::map<Literal, std::pair<Literal, mdp::BytesRangeSet> > NamedTypeInheritanceTable;
 
-    /** Named Types dependency table */
-    typedef std::map<Literal, std::set<Literal> > NamedTypeDependencyTable;
+    /**
+     * Named Types dependency table
+     *
+     * Graph of named types, interned to dense ids, and the types they
+     * depend on. Types referenced before being defined are tracked
+     * without being known to the table until `resolve()`.
+     */
+    class NamedTypeDependencyTable
+    {
+    public:
+        /** Add a named type to the table */
+        void declare(const Literal& identifier);
+
+        /** Check if the named type is known */
+        bool contains(const Literal& identifier) const;
+
+        /** Add a dependency, the dependent becomes known */
+        void addDependency(const Literal& dependent, const Literal& dependency);
+
+        /** Add a dependency of a type in the document prologue, known once resolved */
+        void addPendingDependency(const Literal& dependent, const Literal& dependency);
+
+        /**
+         * \brief Make the pending dependencies known and find circular types
+         *        in a single strongly connected components pass
+         */
+        void resolve();
+
+        /** Check if the named type depended on itself when resolved */
+        bool isCircular(const Literal& identifier) const;
+
+        /** Check if the dependent depends on the dependency, directly or transitively */
+        bool dependsOn(const Literal& dependent, const Literal& dependency) const;
+
+    private:
+        typedef std::vector<Literal>::size_type Id;
+
+        struct Node {
+            bool known = false;
+            bool circular = false;
+            std::vector<Id> dependencies;
+        };
+
+        Id intern(const Literal& identifier);
+        void addEdge(Id dependent, Id dependency);
+
+        std::unordered_map<Literal, Id> m_ids;
+        std::vector<Node> m_nodes;
+        std::unordered_set<unsigned long long> m_edges;
+
+        /** Visit marks of dependsOn(), stamped to avoid clearing them */
+        mutable std::vector<unsigned> m_visited;
+        mutable unsigned m_visitStamp = 0;
+    };
 
     /** A simple or actual value */
     struct Value {
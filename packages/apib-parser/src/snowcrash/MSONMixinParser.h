@@ -59,8 +59,7 @@ namespace snowcrash
             if ((out.node.baseType == mson::PrimitiveBaseType) || (out.node.baseType == mson::UndefinedBaseType)) {
 
                 // WARN: invalid mixin base type
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.warnings.push_back(
                     Warning("mixin type may not include a type of a primitive sub-type", FormattingWarning, sourceMap));
             }
@@ -88,7 +87,7 @@ namespace snowcrash
 
                 TrimString(subject);
 
-                if (RegexMatch(subject, MSONMixinRegex)) {
+                if (RecognizeSignatureKeyword(subject) == IncludeSignatureKeyword) {
                     return MSONMixinSectionType;
                 }
             }
@@ -48,8 +48,7 @@ namespace snowcrash
             if (subject[0] != '`' && RegexMatch(out.node.name.symbol.literal, MSONReservedCharsRegex)) {
 
                 // WARN: named type name should not contain reserved characters
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.warnings.push_back(
                     Warning("please escape the name of the data structure using backticks since it contains MSON "
                             "reserved characters",
@@ -123,7 +122,7 @@ namespace snowcrash
         static SectionType nestedSectionType(const MarkdownNodeIterator& node)
         {
 
-            return SectionProcessor<mson::ValueMember>::nestedSectionType(node);
+            return CachedNestedSectionType<mson::ValueMember>(node);
         }
 
         static void finalize(
@@ -101,21 +101,21 @@ namespace snowcrash
         SectionType nestedType = UndefinedSectionType;
 
         // Check if mson mixin section
-        nestedType = SectionProcessor<mson::Mixin>::sectionType(node);
+        nestedType = CachedSectionType<mson::Mixin>(node);
 
         if (nestedType != UndefinedSectionType) {
             return nestedType;
         }
 
         // Check if mson one of section
-        nestedType = SectionProcessor<mson::OneOf>::sectionType(node);
+        nestedType = CachedSectionType<mson::OneOf>(node);
 
         if (nestedType != UndefinedSectionType) {
             return nestedType;
         }
 
         // Check if mson member type section section
-        nestedType = SectionProcessor<mson::TypeSection>::sectionType(node);
+        nestedType = CachedSectionType<mson::TypeSection>(node);
 
         if (nestedType != UndefinedSectionType) {
             return nestedType;
@@ -45,8 +45,7 @@ namespace snowcrash
             if (out.node.empty()) {
 
                 // WARN: one of type do not have nested members
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.warnings.push_back(
                     Warning("one of type must have nested members", EmptyDefinitionWarning, sourceMap));
             }
@@ -62,7 +61,7 @@ namespace snowcrash
                 subject = GetFirstLine(subject, remaining);
                 TrimString(subject);
 
-                if (RegexMatch(subject, MSONOneOfRegex)) {
+                if (RecognizeSignatureKeyword(subject) == OneOfSignatureKeyword) {
                     return MSONOneOfSectionType;
                 }
             }
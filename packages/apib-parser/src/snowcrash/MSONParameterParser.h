@@ -157,7 +157,7 @@ namespace snowcrash
             SectionType nestedType = UndefinedSectionType;
 
             // Recognize `Default` and `Members` sections
-            nestedType = SectionProcessor<mson::TypeSection>::sectionType(node);
+            nestedType = CachedSectionType<mson::TypeSection>(node);
 
             return nestedType;
         }
@@ -95,7 +95,7 @@ namespace snowcrash
         static SectionType nestedSectionType(const MarkdownNodeIterator& node)
         {
 
-            return SectionProcessor<mson::ValueMember>::nestedSectionType(node);
+            return CachedNestedSectionType<mson::ValueMember>(node);
         }
 
         static void finalize(
@@ -49,8 +49,7 @@ namespace snowcrash
                     if (parentSectionType != MSONPropertyMembersSectionType) {
 
                         // WARN: One of can not be a nested member for a non object structure type
-                        mdp::CharactersRangeSet sourceMap
-                            = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                        SourceBytesLocation sourceMap(node->sourceMap);
                         out.report.warnings.push_back(
                             Warning("one-of can not be a nested member for a type not sub typed from object",
                                 LogicalErrorWarning,
@@ -111,8 +110,7 @@ namespace snowcrash
                     ss << "sample and default type sections cannot have `" << SectionName(pd.sectionContext())
                        << "` type";
 
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                    SourceBytesLocation sourceMap(node->sourceMap);
                     out.report.warnings.push_back(Warning(ss.str(), LogicalErrorWarning, sourceMap));
                     break;
                 }
@@ -186,14 +184,14 @@ namespace snowcrash
         SectionType nestedType = UndefinedSectionType;
 
         // Check if mson mixin section
-        nestedType = SectionProcessor<mson::Mixin>::sectionType(node);
+        nestedType = CachedSectionType<mson::Mixin>(node);
 
         if (nestedType != UndefinedSectionType) {
             return nestedType;
         }
 
         // Check if mson one of section
-        nestedType = SectionProcessor<mson::OneOf>::sectionType(node);
+        nestedType = CachedSectionType<mson::OneOf>(node);
 
         if (nestedType != UndefinedSectionType) {
             return nestedType;
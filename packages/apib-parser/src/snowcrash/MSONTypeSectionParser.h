@@ -70,8 +70,7 @@ namespace snowcrash
                     ss << "type section `" << signature.identifier;
                     ss << "` not allowed for a type sub-typed from a primitive or object type";
 
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                    SourceBytesLocation sourceMap(node->sourceMap);
                     out.report.warnings.push_back(Warning(ss.str(), LogicalErrorWarning, sourceMap));
 
                     return node;
@@ -88,8 +87,7 @@ namespace snowcrash
                     ss << "type section `" << signature.identifier;
                     ss << "` is only allowed for a type sub-typed from an object type";
 
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                    SourceBytesLocation sourceMap(node->sourceMap);
                     out.report.warnings.push_back(Warning(ss.str(), LogicalErrorWarning, sourceMap));
 
                     return node;
@@ -135,8 +133,7 @@ namespace snowcrash
                     || out.node.baseType == mson::ImplicitObjectBaseType) {
 
                     // WARN: sample/default is for an object but it has values in signature
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                    SourceBytesLocation sourceMap(node->sourceMap);
                     out.report.warnings.push_back(
                         Warning("a sample and/or default type section for a type which is sub-typed from an object "
                                 "cannot have value(s) beside the keyword",
@@ -182,20 +179,20 @@ namespace snowcrash
             subject = GetFirstLine(subject, remaining);
             TrimString(subject);
 
-            if (RegexMatch(subject, MSONDefaultTypeSectionRegex) || RegexMatch(subject, MSONSampleTypeSectionRegex)) {
+            switch (RecognizeSignatureKeyword(subject)) {
+                case DefaultSignatureKeyword:
+                case SampleSignatureKeyword:
+                    return MSONSampleDefaultSectionType;
 
-                return MSONSampleDefaultSectionType;
-            }
+                case ValueMembersSignatureKeyword:
+                    return MSONValueMembersSectionType;
 
-            if (RegexMatch(subject, MSONValueMembersTypeSectionRegex)) {
-                return MSONValueMembersSectionType;
-            }
+                case PropertyMembersSignatureKeyword:
+                    return MSONPropertyMembersSectionType;
 
-            if (RegexMatch(subject, MSONPropertyMembersTypeSectionRegex)) {
-                return MSONPropertyMembersSectionType;
+                default:
+                    return UndefinedSectionType;
             }
-
-            return UndefinedSectionType;
         }
 
         static SectionType nestedSectionType(const MarkdownNodeIterator&);
@@ -307,49 +307,36 @@ namespace mson
         bool circularCheck = false)
     {
 
-        // First, check if the type exists
-        if (pd.namedTypeDependencyTable.find(dependency) == pd.namedTypeDependencyTable.end()) {
+        bool added = false;
+
+        // First, check if the type exists, second, if it is circular reference between them
+        if (!pd.namedTypeDependencyTable.contains(dependency)) {
 
             // ERR: We cannot find the dependency type
             std::stringstream ss;
             ss << "base type '" << dependency << "' is not defined in the document";
 
-            mdp::CharactersRangeSet sourceMap
-                = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+            snowcrash::SourceBytesLocation sourceMap(node->sourceMap);
             report.error = snowcrash::Error(ss.str(), snowcrash::MSONError, sourceMap);
-            return;
-        }
-
-        std::set<mson::Literal> dependencyDeps = pd.namedTypeDependencyTable[dependency];
-
-        // Second, check if it is circular reference between them
-        if (circularCheck && (dependent == dependency || dependencyDeps.find(dependent) != dependencyDeps.end())) {
+        } else if (circularCheck
+            && (dependent == dependency || pd.namedTypeDependencyTable.dependsOn(dependency, dependent))) {
 
             // ERR: Dependency named type circular references itself
             std::stringstream ss;
             ss << "base type '" << dependent << "' circularly referencing itself";
 
-            mdp::CharactersRangeSet sourceMap
-                = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+            snowcrash::SourceBytesLocation sourceMap(node->sourceMap);
             report.error = snowcrash::Error(ss.str(), snowcrash::MSONError, sourceMap);
-            return;
-        }
+        } else {
 
-        // Third, check if the dependency is already in the list
-        if (pd.namedTypeDependencyTable[dependent].find(dependency) != pd.namedTypeDependencyTable[dependent].end()) {
-            return;
+            // Transitive dependencies are followed when checked, adding one is constant time
+            pd.namedTypeDependencyTable.addDependency(dependent, dependency);
+            added = true;
         }
 
-        for (mson::NamedTypeDependencyTable::iterator it = pd.namedTypeDependencyTable.begin();
-             it != pd.namedTypeDependencyTable.end();
-             ++it) {
-
-            // If the entry is dependent itself or contain dependent in its list
-            if (it->first == dependent || it->second.find(dependent) != it->second.end()) {
-
-                it->second.insert(dependency);
-                it->second.insert(dependencyDeps.begin(), dependencyDeps.end());
-            }
+        // Either outcome may be different after the preceding top-level sections
+        if (pd.sharedStateLog) {
+            pd.sharedStateLog->dependencies.push_back({ dependency, dependent, circularCheck, added });
         }
     }
 
@@ -380,8 +367,7 @@ namespace mson
                 if (foundTypeSpecification) {
 
                     // WARN: Ignoring unrecognized type attribute
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                    snowcrash::SourceBytesLocation sourceMap(node->sourceMap);
                     report.warnings.push_back(snowcrash::Warning(
                         "ignoring unrecognized type attribute", snowcrash::IgnoringWarning, sourceMap));
                 } else {
@@ -412,8 +398,7 @@ namespace mson
             && !typeDefinition.typeSpecification.nestedTypes.empty()) {
 
             // WARN: Nested types for non (array or enum) structure base type
-            mdp::CharactersRangeSet sourceMap
-                = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+            snowcrash::SourceBytesLocation sourceMap(node->sourceMap);
             report.warnings.push_back(
                 snowcrash::Warning("nested types should be present only for types which are sub typed from either "
                                    "array or enum structure type",
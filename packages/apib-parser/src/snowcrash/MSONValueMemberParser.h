@@ -86,7 +86,7 @@ namespace snowcrash
         static bool isDescriptionNode(const MarkdownNodeIterator& node, SectionType sectionType)
         {
 
-            if (SectionProcessor<mson::ValueMember>::nestedSectionType(node) != MSONSectionType
+            if (CachedNestedSectionType<mson::ValueMember>(node) != MSONSectionType
                 || node->type == mdp::HeaderMarkdownNodeType) {
 
                 return false;
@@ -144,8 +144,7 @@ namespace snowcrash
                 ss << "overshadowing previous 'values' definition";
                 ss << " for parameter '" << out.node.name << "'";
 
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.warnings.push_back(Warning(ss.str(), RedefinitionWarning, sourceMap));
             }
 
@@ -164,8 +163,7 @@ namespace snowcrash
                 std::stringstream ss;
                 ss << "no possible values specified for parameter '" << out.node.name << "'";
 
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.warnings.push_back(Warning(ss.str(), EmptyDefinitionWarning, sourceMap));
             }
 
@@ -198,15 +196,17 @@ namespace snowcrash
                         itSubject = GetFirstLine(it->children().front().text, itRemainingContent);
                         TrimString(itSubject);
 
-                        if (RegexMatch(itSubject, MSONDefaultTypeSectionRegex)
-                            || RegexMatch(itSubject, MSONSampleTypeSectionRegex)
-                            || RegexMatch(itSubject, MSONValueMembersTypeSectionRegex)) {
+                        switch (RecognizeSignatureKeyword(itSubject)) {
+                            case DefaultSignatureKeyword:
+                            case SampleSignatureKeyword:
+                            case ValueMembersSignatureKeyword:
+                                return MSONParameterSectionType;
 
-                            return MSONParameterSectionType;
-                        }
+                            case ValuesSignatureKeyword:
+                                return ParameterSectionType;
 
-                        if (RegexMatch(itSubject, ParameterValuesRegex)) {
-                            return ParameterSectionType;
+                            default:
+                                break;
                         }
                     }
                 }
@@ -228,7 +228,7 @@ namespace snowcrash
         static SectionType nestedSectionType(const MarkdownNodeIterator& node)
         {
 
-            return SectionProcessor<Values>::sectionType(node);
+            return CachedSectionType<Values>(node);
         }
 
         template <typename T>
@@ -306,8 +306,7 @@ namespace snowcrash
             ss << "unable to parse additional parameter traits";
             ss << (oldSyntax ? OldSyntaxAdditionalTraitsWarning : NewSyntaxAdditionalTraitsWarning);
 
-            mdp::CharactersRangeSet sourceMap
-                = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+            SourceBytesLocation sourceMap(node->sourceMap);
             out.report.warnings.push_back(Warning(ss.str(), FormattingWarning, sourceMap));
 
             out.node.type.clear();
@@ -342,8 +341,7 @@ namespace snowcrash
                    << "' as required supersedes its default value"
                       ", declare the parameter as 'optional' to specify its default value";
 
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.warnings.push_back(Warning(ss.str(), LogicalErrorWarning, sourceMap));
             }
         }
@@ -392,8 +390,7 @@ namespace snowcrash
             }
 
             if (printWarning) {
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.warnings.push_back(Warning(ss.str(), LogicalErrorWarning, sourceMap));
             }
         }
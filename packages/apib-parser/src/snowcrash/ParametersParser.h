@@ -55,8 +55,7 @@ namespace snowcrash
                 ss << "ignoring additional content after 'parameters' keyword,";
                 ss << " expected a nested list of parameters, one parameter per list item";
 
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.warnings.push_back(Warning(ss.str(), IgnoringWarning, sourceMap));
             }
 
@@ -98,8 +97,7 @@ namespace snowcrash
                     std::stringstream ss;
                     ss << "overshadowing previous parameter '" << parameter.node.name << "' definition";
 
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                    SourceBytesLocation sourceMap(node->sourceMap);
                     out.report.warnings.push_back(Warning(ss.str(), RedefinitionWarning, sourceMap));
                 }
             }
@@ -123,7 +121,7 @@ namespace snowcrash
                 subject = GetFirstLine(subject, remaining);
                 TrimString(subject);
 
-                if (RegexMatch(subject, ParametersRegex)) {
+                if (RecognizeSignatureKeyword(subject) == ParametersSignatureKeyword) {
                     return ParametersSectionType;
                 }
             }
@@ -134,7 +132,7 @@ namespace snowcrash
         static SectionType nestedSectionType(const MarkdownNodeIterator& node)
         {
 
-            return SectionProcessor<Parameter>::sectionType(node);
+            return CachedSectionType<Parameter>(node);
         }
 
         static void finalize(
@@ -144,8 +142,7 @@ namespace snowcrash
             if (out.node.empty()) {
 
                 // WARN: No parameters defined
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.warnings.push_back(Warning(NoParametersMessage, FormattingWarning, sourceMap));
             }
         }
@@ -184,8 +181,7 @@ namespace snowcrash
             ss << " for '" << out.node.name << "' ";
         }
 
-        mdp::CharactersRangeSet sourceMap
-            = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+        SourceBytesLocation sourceMap(node->sourceMap);
         out.report.warnings.push_back(Warning(ss.str(), LogicalErrorWarning, sourceMap));
     }
 
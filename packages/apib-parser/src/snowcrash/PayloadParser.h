@@ -60,6 +60,8 @@ namespace snowcrash
             const ParseResultRef<Payload>& out)
         {
 
+            pd.checkpoint(*node);
+
             mdp::ByteBuffer signature, remainingContent;
             signature = GetFirstLine(node->text, remainingContent);
 
@@ -69,8 +71,7 @@ namespace snowcrash
             if (out.node.name.empty()
                 && (pd.sectionContext() == ResponseSectionType || pd.sectionContext() == ResponseBodySectionType)) {
 
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.warnings.push_back(Warning(
                     "missing response HTTP status code, assuming 'Response 200'", EmptyDefinitionWarning, sourceMap));
                 out.node.name = "200";
@@ -120,8 +121,7 @@ namespace snowcrash
                 ss << "ignoring extraneous content after model reference";
                 ss << ", expected model reference only e.g. '[" << out.node.reference.id << "][]'";
 
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.warnings.push_back(Warning(ss.str(), IgnoringWarning, sourceMap));
             } else {
 
@@ -165,8 +165,7 @@ namespace snowcrash
                 case ParametersSectionType: {
                     if (pd.parentSectionContext() != RequestSectionType) {
                         // WARN: Only request section can have parameters section
-                        mdp::CharactersRangeSet sourceMap
-                            = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                        SourceBytesLocation sourceMap(node->sourceMap);
                         out.report.warnings.push_back(
                             Warning("ignoring parameters section in a non request payload section",
                                 IgnoringWarning,
@@ -182,8 +181,7 @@ namespace snowcrash
                 case BodySectionType: {
                     if (!out.node.body.empty()) {
                         // WARN: Multiple body section
-                        mdp::CharactersRangeSet sourceMap
-                            = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                        SourceBytesLocation sourceMap(node->sourceMap);
                         out.report.warnings.push_back(
                             Warning("ignoring additional 'body' content, it is already defined",
                                 RedefinitionWarning,
@@ -197,8 +195,7 @@ namespace snowcrash
                 case SchemaSectionType: {
                     if (!out.node.schema.empty()) {
                         // WARN: Multiple schema section
-                        mdp::CharactersRangeSet sourceMap
-                            = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                        SourceBytesLocation sourceMap(node->sourceMap);
                         out.report.warnings.push_back(
                             Warning("ignoring additional 'schema' content, it is already defined",
                                 RedefinitionWarning,
@@ -295,28 +292,28 @@ namespace snowcrash
             SectionType nestedType = UndefinedSectionType;
 
             // Check if headers section
-            nestedType = SectionProcessor<Headers>::sectionType(node);
+            nestedType = CachedSectionType<Headers>(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if asset section
-            nestedType = SectionProcessor<Asset>::sectionType(node);
+            nestedType = CachedSectionType<Asset>(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if attributes section
-            nestedType = SectionProcessor<Attributes>::sectionType(node);
+            nestedType = CachedSectionType<Attributes>(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if parameters section
-            nestedType = SectionProcessor<Parameters>::sectionType(node);
+            nestedType = CachedSectionType<Parameters>(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
@@ -351,13 +348,18 @@ namespace snowcrash
             signature = GetFirstLine(subject, remainingContent);
             TrimString(signature);
 
-            if (RegexMatch(signature, RequestRegex))
-                return RequestPayloadSignature;
+            switch (RecognizeSignatureKeyword(signature)) {
+                case RequestSignatureKeyword:
+                    return RequestPayloadSignature;
 
-            if (RegexMatch(signature, ResponseRegex))
-                return ResponsePayloadSignature;
+                case ResponseSignatureKeyword:
+                    return ResponsePayloadSignature;
 
-            if (RegexMatch(signature, ModelRegex))
+                default:
+                    break;
+            }
+
+            if (IsModelSignature(signature))
                 return ModelPayloadSignature;
 
             return NoPayloadSignature;
@@ -459,8 +461,7 @@ namespace snowcrash
                             return false;
                     }
 
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                    SourceBytesLocation sourceMap(node->sourceMap);
                     out.report.warnings.push_back(Warning(ss.str(), FormattingWarning, sourceMap));
 
                     return false;
@@ -531,6 +532,10 @@ namespace snowcrash
 
                     out.node.reference.meta.state = Reference::StatePending;
 
+                    if (pd.sharedStateLog) {
+                        pd.sharedStateLog->modelMisses.push_back(symbol);
+                    }
+
                     return true;
                 }
 
@@ -573,8 +578,7 @@ namespace snowcrash
                 ss << "ignoring additional " << SectionName(pd.sectionContext()) << " header(s), ";
                 ss << "specify this header(s) in the referenced model definition instead";
 
-                mdp::CharactersRangeSet sourceMap = mdp::BytesRangeSetToCharactersRangeSet(
-                    out.node.reference.meta.node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(out.node.reference.meta.node->sourceMap);
                 out.report.warnings.push_back(Warning(ss.str(), IgnoringWarning, sourceMap));
             }
 
@@ -656,8 +660,7 @@ namespace snowcrash
                            << "' Transfer-Encoding";
                     }
 
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                    SourceBytesLocation sourceMap(node->sourceMap);
                     out.report.warnings.push_back(Warning(ss.str(), EmptyDefinitionWarning, sourceMap));
                 }
             }
@@ -688,8 +691,7 @@ namespace snowcrash
                 std::stringstream ss;
                 ss << "the " << code << " response MUST NOT include a " << SectionName(BodySectionType);
 
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.warnings.push_back(Warning(ss.str(), EmptyDefinitionWarning, sourceMap));
             }
         }
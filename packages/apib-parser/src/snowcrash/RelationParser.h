@@ -47,8 +47,7 @@ namespace snowcrash
                 TrimString(out.node.str);
             } else {
                 // WARN: Relation identifier contains illegal characters
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.warnings.push_back(
                     Warning("relation identifier contains illegal characters (only lower case letters, numbers, '-' "
                             "and '.' allowed)",
@@ -75,7 +74,7 @@ namespace snowcrash
                 subject = GetFirstLine(subject, remaining);
                 TrimString(subject);
 
-                if (RegexMatch(subject, RelationRegex)) {
+                if (RecognizeSignatureKeyword(subject) == RelationSignatureKeyword) {
                     return RelationSectionType;
                 }
             }
@@ -121,8 +121,7 @@ namespace snowcrash
                 if (duplicate || globalDuplicate) {
 
                     // WARN: Duplicate resource
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                    SourceBytesLocation sourceMap(node->sourceMap);
                     out.report.warnings.push_back(
                         Warning("the resource '" + resource.node.uriTemplate + "' is already defined",
                             DuplicateWarning,
@@ -159,8 +158,7 @@ namespace snowcrash
                 mdp::ByteBuffer method, name, uriTemplate;
 
                 SectionProcessor<Action>::actionHTTPMethodAndName(node, method, name, uriTemplate);
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
 
                 // WARN: Unexpected action
                 std::stringstream ss;
@@ -198,7 +196,7 @@ namespace snowcrash
                 mdp::ByteBuffer subject = node->text;
                 TrimString(subject);
 
-                if (RegexMatch(subject, GroupHeaderRegex)) {
+                if (RecognizeSignatureKeyword(subject) == GroupSignatureKeyword) {
                     return ResourceGroupSectionType;
                 }
             }
@@ -210,7 +208,7 @@ namespace snowcrash
         {
 
             // Return ResourceSectionType or UndefinedSectionType
-            return SectionProcessor<Resource>::sectionType(node);
+            return CachedSectionType<Resource>(node);
         }
 
         static SectionTypes upperSectionTypes()
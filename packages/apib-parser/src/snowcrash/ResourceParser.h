@@ -46,6 +46,8 @@ namespace snowcrash
             const ParseResultRef<Resource>& out)
         {
 
+            pd.checkpoint(*node);
+
             CaptureGroups captureGroups;
 
             // If Abbreviated resource section
@@ -123,8 +125,7 @@ namespace snowcrash
                             std::stringstream ss;
                             ss << "named type with name '" << out.node.name << "' already exists";
 
-                            mdp::CharactersRangeSet sourceMap
-                                = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                            SourceBytesLocation sourceMap(node->sourceMap);
                             out.report.warnings.push_back(Warning(ss.str(), DuplicateWarning, sourceMap));
 
                             // Remove the attributes data from the AST since we are ignoring this
@@ -176,6 +177,8 @@ namespace snowcrash
                     if (pd.exportSourceMap()) {
                         pd.modelSourceMapTable[out.node.model.name].body = out.sourceMap.model.body;
                     }
+                } else if (pd.sharedStateLog) {
+                    pd.sharedStateLog->modelMisses.push_back(out.node.model.name);
                 }
 
                 return ++MarkdownNodeIterator(node);
@@ -219,21 +222,21 @@ namespace snowcrash
             SectionType nestedType = UndefinedSectionType;
 
             // Check if parameters section
-            nestedType = SectionProcessor<Parameters>::sectionType(node);
+            nestedType = CachedSectionType<Parameters>(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if headers section
-            nestedType = SectionProcessor<Headers>::sectionType(node);
+            nestedType = CachedSectionType<Headers>(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if model section
-            nestedType = SectionProcessor<Payload>::sectionType(node);
+            nestedType = CachedSectionType<Payload>(node);
 
             if (nestedType == ModelSectionType || nestedType == ModelBodySectionType) {
 
@@ -241,14 +244,14 @@ namespace snowcrash
             }
 
             // Check if attributes section
-            nestedType = SectionProcessor<Attributes>::sectionType(node);
+            nestedType = CachedSectionType<Attributes>(node);
 
             if (nestedType != UndefinedSectionType) {
                 return nestedType;
             }
 
             // Check if action section
-            nestedType = SectionProcessor<Action>::sectionType(node);
+            nestedType = CachedSectionType<Action>(node);
 
             if (nestedType == ActionSectionType) {
 
@@ -277,7 +280,7 @@ namespace snowcrash
                 URITemplateParser uriTemplateParser;
                 ParsedURITemplate parsedResult;
                 mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.characterIndex);
 
                 uriTemplateParser.parse(out.node.uriTemplate, sourceMap, parsedResult);
 
@@ -368,8 +371,7 @@ namespace snowcrash
                 ss << "action with method '" << action.node.method << "' already defined for resource '";
                 ss << out.node.uriTemplate << "'";
 
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.warnings.push_back(Warning(ss.str(), DuplicateWarning, sourceMap));
             }
 
@@ -383,8 +385,7 @@ namespace snowcrash
                 ss << "relation identifier '" << action.node.relation.str << "' already defined for resource '"
                    << out.node.uriTemplate << "'";
 
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.warnings.push_back(Warning(ss.str(), DuplicateWarning, sourceMap));
             }
 
@@ -453,8 +454,7 @@ namespace snowcrash
 
                 ss << "' resource, a resource can be represented by a single model only";
 
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.warnings.push_back(Warning(ss.str(), DuplicateWarning, sourceMap));
             }
 
@@ -473,8 +473,7 @@ namespace snowcrash
                     ss << "resource model can be specified only for a named resource";
                     ss << ", name your resource, e.g. '# <resource name> [" << out.node.uriTemplate << "]'";
 
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                    SourceBytesLocation sourceMap(node->sourceMap);
                     out.report.error = Error(ss.str(), ModelError, sourceMap);
                 }
             }
@@ -494,8 +493,7 @@ namespace snowcrash
                 std::stringstream ss;
                 ss << "symbol '" << model.node.name << "' already defined";
 
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(node->sourceMap);
                 out.report.error = Error(ss.str(), ModelError, sourceMap);
             }
 
@@ -99,18 +99,40 @@ namespace snowcrash
             const ParseResultRef<T>& out)
         {
 
+            SectionProcessor<T>::preprocessNestedSections(node, collection, pd, out);
+
+            // Nested sections parsed concurrently, if any, are skipped
+            MarkdownNodeIterator cur = SectionProcessor<T>::parseNestedSectionsConcurrently(node, collection, pd, out);
+
+            return parseNestedSectionsUntil(cur, collection.end(), collection, pd, out);
+        }
+
+        /**
+         *  \brief  Parse nested sections up to a node
+         *  \param  node    Node to start parsing at
+         *  \param  stop    Node to stop at, a nested section may end past it
+         *  \param  collection  Siblings of the nodes
+         *  \param  pd      Parser data
+         *  \param  out     Parsed output
+         *  \return Iterator to the first unparsed block
+         */
+        static MarkdownNodeIterator parseNestedSectionsUntil(const MarkdownNodeIterator& node,
+            const MarkdownNodes::const_iterator& stop,
+            const MarkdownNodes& collection,
+            SectionParserData& pd,
+            const ParseResultRef<T>& out)
+        {
+
             MarkdownNodeIterator cur = node;
             MarkdownNodeIterator lastCur = cur;
 
             SectionType lastSectionType = UndefinedSectionType;
 
-            SectionProcessor<T>::preprocessNestedSections(node, collection, pd, out);
-
             // Nested sections
-            while (cur != collection.end()) {
+            while (MarkdownNodes::const_iterator(cur) < stop) {
 
                 lastCur = cur;
-                SectionType nestedType = SectionProcessor<T>::nestedSectionType(cur);
+                SectionType nestedType = CachedNestedSectionType<T>(cur);
 
                 pd.sectionsContext.push_back(nestedType);
 
@@ -148,8 +170,7 @@ namespace snowcrash
         {
             if (seed->type != mdp::HeaderMarkdownNodeType) {
                 // ERR: Expected header
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(seed->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(seed->sourceMap);
                 throw Error("expected header block, e.g. '# <text>'", BusinessError, sourceMap);
             }
 
@@ -188,8 +209,7 @@ namespace snowcrash
         {
             if (seed->type != mdp::ListItemMarkdownNodeType) {
                 // ERR: Expected list item
-                mdp::CharactersRangeSet sourceMap
-                    = mdp::BytesRangeSetToCharactersRangeSet(seed->sourceMap, pd.sourceCharacterIndex);
+                SourceBytesLocation sourceMap(seed->sourceMap);
                 throw Error("expected list item block, e.g. '+ <text>'", BusinessError, sourceMap);
             }
 
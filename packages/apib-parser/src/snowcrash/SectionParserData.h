@@ -12,6 +12,10 @@
 #include "ModelTable.h"
 #include "BlueprintSourcemap.h"
 #include "Section.h"
+#include "SourceAnnotation.h"
+#include "MarkdownNode.h"
+
+#include <functional>
 
 namespace snowcrash
 {
@@ -30,6 +34,43 @@ namespace snowcrash
 
     typedef unsigned int BlueprintParserOptions;
 
+    /**
+     *  \brief Callback polled as the parser advances through the source
+     *
+     *  Called with the byte offset of the section about to be parsed, possibly
+     *  from several threads at once if top-level sections are parsed
+     *  concurrently; the offsets then need not increase.
+     *
+     *  An %Error the callback throws ends the parse with it.
+     *
+     *  \return False to cancel the parse
+     */
+    typedef std::function<bool(size_t offset)> ProgressCallback;
+
+    /**
+     *  \brief Lookups of parser state other top-level sections change
+     *
+     *  Kept while a range of top-level sections is parsed before the ones
+     *  preceding it, to tell whether the range would have been parsed the
+     *  same after them.
+     */
+    struct SharedStateLog {
+
+        /** Dependency between named types as it was added or refused */
+        struct Dependency {
+            mson::Literal dependency;
+            mson::Literal dependent;
+            bool circularCheck;
+            bool added;
+        };
+
+        /** Dependencies in the order they were added or refused */
+        std::vector<Dependency> dependencies;
+
+        /** Names looked up in the model table but not found */
+        std::vector<mdp::ByteBuffer> modelMisses;
+    };
+
     /**
      *  \brief Section Parser Data
      *
@@ -37,7 +78,30 @@ namespace snowcrash
      */
     struct SectionParserData {
         SectionParserData(BlueprintParserOptions opts, const mdp::ByteBuffer& src, const Blueprint& bp)
-            : options(opts), sourceData(src), blueprint(bp)
+            : options(opts), sourceData(src), characterIndex(sourceCharacterIndex), blueprint(bp)
+        {
+        }
+
+        /**
+         *  \brief Parser data of a range of top-level sections parsed ahead
+         *
+         *  Starts with a copy of the parent's tables and shares its source.
+         */
+        SectionParserData(const SectionParserData& parent, const Blueprint& bp, SharedStateLog& log)
+            : options(parent.options),
+              msonTypesTable(parent.msonTypesTable),
+              namedTypeBaseTable(parent.namedTypeBaseTable),
+              namedTypeInheritanceTable(parent.namedTypeInheritanceTable),
+              namedTypeDependencyTable(parent.namedTypeDependencyTable),
+              namedTypeContext(parent.namedTypeContext),
+              modelTable(parent.modelTable),
+              modelSourceMapTable(parent.modelSourceMapTable),
+              sourceData(parent.sourceData),
+              characterIndex(parent.characterIndex),
+              blueprint(bp),
+              sectionsContext(parent.sectionsContext),
+              progress(parent.progress),
+              sharedStateLog(&log)
         {
         }
 
@@ -71,6 +135,9 @@ namespace snowcrash
         /** Source - map of bytes to character position - performance optimization */
         mdp::ByteBufferCharacterIndex sourceCharacterIndex;
 
+        /** Character index in use, the parent's one for sections parsed ahead */
+        const mdp::ByteBufferCharacterIndex& characterIndex;
+
         /** AST being parsed **/
         const Blueprint& blueprint;
 
@@ -78,6 +145,15 @@ namespace snowcrash
         typedef std::vector<SectionType> SectionsStack;
         SectionsStack sectionsContext;
 
+        /** Number of threads top-level sections may be parsed with */
+        unsigned concurrency = 0;
+
+        /** Progress callback, if any */
+        const ProgressCallback* progress = nullptr;
+
+        /** Log of shared state lookups, set while parsing sections ahead */
+        SharedStateLog* sharedStateLog = nullptr;
+
         /** \returns Actual Section Context */
         SectionType sectionContext() const
         {
@@ -98,6 +174,19 @@ namespace snowcrash
                 return sectionsContext[size - 2];
         }
 
+        /**
+         *  \brief Report progress before parsing a section
+         *
+         *  Cheap enough for every resource and payload, but not for every node.
+         *  Throws an error of %CancellationError code if the parse is cancelled.
+         */
+        void checkpoint(const mdp::MarkdownNode& node) const
+        {
+            if (progress && !(*progress)(node.sourceMap.empty() ? 0 : node.sourceMap.front().location)) {
+                throw Error("parsing cancelled", CancellationError);
+            }
+        }
+
         /** \returns True if exporting source maps */
         bool exportSourceMap() const
         {
@@ -12,6 +12,7 @@
 #include "SectionParserData.h"
 #include "SourceAnnotation.h"
 #include "Signature.h"
+#include "SectionTypeCache.h"
 
 // Use the following macro whenever a section doesn't have description
 #define NO_SECTION_DESCRIPTION(T)                                                                                      \
@@ -118,6 +119,26 @@ namespace snowcrash
     template <typename T>
     struct SectionProcessor;
 
+    /** \return %SectionType of the node as classified by SectionProcessor<T>, see %SectionTypeCache */
+    template <typename T>
+    SectionType CachedSectionType(const MarkdownNodeIterator& node)
+    {
+        static const char classifier = 0;
+        return SectionTypeCache::lookup(*node, &classifier, [&node]() { //
+            return SectionProcessor<T>::sectionType(node);
+        });
+    }
+
+    /** \return Nested %SectionType of the node as classified by SectionProcessor<T>, see %SectionTypeCache */
+    template <typename T>
+    SectionType CachedNestedSectionType(const MarkdownNodeIterator& node)
+    {
+        static const char classifier = 0;
+        return SectionTypeCache::lookup(*node, &classifier, [&node]() { //
+            return SectionProcessor<T>::nestedSectionType(node);
+        });
+    }
+
     /**
      *  \brief  Section Processor Base
      *
@@ -190,6 +211,21 @@ namespace snowcrash
         {
         }
 
+        /**
+         * Parse leading nested sections concurrently, after the pre-process
+         * Only used by BlueprintParser for now
+         *
+         * \return Iterator to the first nested section left to parse
+         */
+        static MarkdownNodeIterator parseNestedSectionsConcurrently(const MarkdownNodeIterator& node,
+            const MarkdownNodes& siblings,
+            SectionParserData& pd,
+            const ParseResultRef<T>& out)
+        {
+
+            return node;
+        }
+
         /**
          *  \brief Process nested sections Markdown node(s)
          *  \param node     Node to process
@@ -217,8 +253,7 @@ namespace snowcrash
 
             // WARN: Ignoring unexpected node
             std::stringstream ss;
-            mdp::CharactersRangeSet sourceMap
-                = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+            SourceBytesLocation sourceMap(node->sourceMap);
 
             if (node->type == mdp::HeaderMarkdownNodeType) {
                 ss << "unexpected header block, expected a group, resource or an action definition";
@@ -240,7 +275,7 @@ namespace snowcrash
         {
 
             if (SectionProcessor<T>::isContentNode(node, sectionType)
-                || SectionProcessor<T>::nestedSectionType(node) != UndefinedSectionType) {
+                || CachedNestedSectionType<T>(node) != UndefinedSectionType) {
                 return false;
             }
 
@@ -306,6 +341,7 @@ namespace snowcrash
     template <typename T>
     struct SectionProcessor : public SectionProcessorBase<T> {
     };
+
 }
 
 #endif
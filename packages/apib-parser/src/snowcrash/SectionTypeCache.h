@@ -0,0 +1,117 @@
+//
+//  SectionTypeCache.h
+//  snowcrash
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_SECTIONTYPECACHE_H
+#define SNOWCRASH_SECTIONTYPECACHE_H
+
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include "MarkdownNode.h"
+#include "Section.h"
+
+namespace snowcrash
+{
+
+    /**
+     *  \brief Memo of Markdown node classifications
+     *
+     *  Section parsers ask for the section type of the same node many times,
+     *  e.g. once per candidate nested section and again when deciding whether
+     *  it is a description or an unexpected node. Classification is a pure
+     *  function of the node, so while a cache is in scope each classifier
+     *  runs at most once per node.
+     *
+     *  Outside of a scope classifications are not cached, the nodes may then
+     *  be modified between them.
+     */
+    class SectionTypeCache
+    {
+    public:
+        /** Makes the cache current for the calling thread, it is cleared once the scope ends */
+        class Scope
+        {
+        public:
+            explicit Scope(SectionTypeCache& cache) : m_cache(cache), m_previous(current())
+            {
+                current() = &m_cache;
+            }
+
+            ~Scope()
+            {
+                m_cache.m_types.clear();
+                current() = m_previous;
+            }
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            SectionTypeCache& m_cache;
+            SectionTypeCache* m_previous;
+        };
+
+        /**
+         *  \brief Classify a node
+         *
+         *  \param node         Node to classify
+         *  \param classifier   Identity of the classification
+         *  \param classify     Classification to run if not cached
+         */
+        template <typename Classify>
+        static SectionType lookup(const mdp::MarkdownNode& node, const void* classifier, Classify classify)
+        {
+            SectionTypeCache* cache = current();
+
+            if (!cache) {
+                return classify();
+            }
+
+            const Key key = { &node, classifier };
+            auto it = cache->m_types.find(key);
+
+            if (it != cache->m_types.end()) {
+                return it->second;
+            }
+
+            // classifications may nest, e.g. for child nodes, so no iterator is kept
+            const SectionType type = classify();
+            cache->m_types.emplace(key, type);
+
+            return type;
+        }
+
+    private:
+        struct Key {
+            const mdp::MarkdownNode* node;
+            const void* classifier;
+
+            bool operator==(const Key& rhs) const
+            {
+                return node == rhs.node && classifier == rhs.classifier;
+            }
+        };
+
+        struct KeyHash {
+            std::size_t operator()(const Key& key) const
+            {
+                const std::size_t h = std::hash<const void*>()(key.node);
+                return h ^ (std::hash<const void*>()(key.classifier) + 0x9e3779b9 + (h << 6) + (h >> 2));
+            }
+        };
+
+        static SectionTypeCache*& current()
+        {
+            static thread_local SectionTypeCache* cache = nullptr;
+            return cache;
+        }
+
+        std::unordered_map<Key, SectionType, KeyHash> m_types;
+    };
+}
+
+#endif
@@ -7,6 +7,10 @@
 //
 
 #include "Signature.h"
+
+#include <algorithm>
+#include <cstring>
+
 #include "SectionParser.h"
 #include "ActionParser.h"
 #include "AssetParser.h"
@@ -21,11 +25,11 @@
 using namespace snowcrash;
 
 #define TYPECHECK(T)                                                                                                   \
-    if ((type = SectionProcessor<T>::sectionType(node)) != UndefinedSectionType) {                                     \
+    if ((type = CachedSectionType<T>(node)) != UndefinedSectionType) {                                                 \
         return type;                                                                                                   \
     }
 
-SectionType snowcrash::SectionKeywordSignature(const mdp::MarkdownNodeIterator& node)
+static SectionType ClassifyKeywordSignature(const mdp::MarkdownNodeIterator& node)
 {
     // Note: Every-keyword defined section should be listed here...
     SectionType type = UndefinedSectionType;
@@ -55,19 +59,281 @@ SectionType snowcrash::SectionKeywordSignature(const mdp::MarkdownNodeIterator&
     return type;
 }
 
+SectionType snowcrash::SectionKeywordSignature(const mdp::MarkdownNodeIterator& node)
+{
+    static const char classifier = 0;
+    return SectionTypeCache::lookup(*node, &classifier, [&node]() { return ClassifyKeywordSignature(node); });
+}
+
 SectionType snowcrash::RecognizeCodeBlockFirstLine(const mdp::ByteBuffer& subject)
 {
-    SectionType type = UndefinedSectionType;
+    switch (RecognizeSignatureKeyword(subject)) {
+        case HeadersSignatureKeyword:
+            return HeadersSectionType;
+
+        case BodySignatureKeyword:
+            return BodySectionType;
 
-    if (RegexMatch(subject, HeadersRegex)) {
-        return HeadersSectionType;
-    } else if (RegexMatch(subject, BodyRegex)) {
-        return BodySectionType;
-    } else if (RegexMatch(subject, SchemaRegex)) {
-        return SchemaSectionType;
+        case SchemaSignatureKeyword:
+            return SchemaSectionType;
+
+        default:
+            return UndefinedSectionType;
     }
+}
 
-    return type;
+namespace
+{
+    inline bool IsBlank(char c)
+    {
+        return c == ' ' || c == '\t';
+    }
+
+    inline bool IsBracket(char c)
+    {
+        return c == '[' || c == ']' || c == '(' || c == ')';
+    }
+
+    /**
+     *  Cursor over a signature
+     *
+     *  The signature ends at its first null character, as the C string seen
+     *  by the regular expressions it replaces does.
+     */
+    class KeywordScanner
+    {
+        const char* m_it;
+        const char* m_end;
+
+    public:
+        explicit KeywordScanner(const mdp::ByteBuffer& subject) : m_it(subject.data())
+        {
+            const void* nul = std::memchr(m_it, '\0', subject.size());
+            m_end = nul ? static_cast<const char*>(nul) : m_it + subject.size();
+        }
+
+        const char* begin() const
+        {
+            return m_it;
+        }
+
+        const char* end() const
+        {
+            return m_end;
+        }
+
+        bool atEnd() const
+        {
+            return m_it == m_end;
+        }
+
+        char peek() const
+        {
+            return atEnd() ? '\0' : *m_it;
+        }
+
+        /** Consume a lowercase keyword whose first letter may be capitalized */
+        bool keyword(const char* word)
+        {
+            const std::size_t length = std::strlen(word);
+
+            if (static_cast<std::size_t>(m_end - m_it) < length)
+                return false;
+
+            if (m_it[0] != word[0] && m_it[0] != word[0] - 'a' + 'A')
+                return false;
+
+            if (std::memcmp(m_it + 1, word + 1, length - 1) != 0)
+                return false;
+
+            m_it += length;
+            return true;
+        }
+
+        bool optional(char c)
+        {
+            if (peek() != c || atEnd())
+                return false;
+
+            ++m_it;
+            return true;
+        }
+
+        /** \return Number of blanks skipped */
+        std::size_t blanks()
+        {
+            const char* start = m_it;
+
+            while (!atEnd() && IsBlank(*m_it))
+                ++m_it;
+
+            return m_it - start;
+        }
+
+        bool onlyBlanks()
+        {
+            blanks();
+            return atEnd();
+        }
+    };
+}
+
+SignatureKeyword snowcrash::RecognizeSignatureKeyword(const mdp::ByteBuffer& subject)
+{
+    KeywordScanner scan(subject);
+    scan.blanks();
+
+    switch (scan.peek()) {
+        case 'H':
+        case 'h':
+            if (scan.keyword("header")) {
+                scan.optional('s');
+                return scan.onlyBlanks() ? HeadersSignatureKeyword : NoSignatureKeyword;
+            }
+            break;
+
+        case 'B':
+        case 'b':
+            if (scan.keyword("body") && scan.onlyBlanks())
+                return BodySignatureKeyword;
+            break;
+
+        case 'S':
+        case 's':
+            if (scan.keyword("schema")) {
+                return scan.onlyBlanks() ? SchemaSignatureKeyword : NoSignatureKeyword;
+            } else if (scan.keyword("sample")) {
+                scan.blanks();
+                return (scan.atEnd() || scan.peek() == ':') ? SampleSignatureKeyword : NoSignatureKeyword;
+            }
+            break;
+
+        case 'A':
+        case 'a':
+            if (scan.keyword("attribute")) {
+                scan.optional('s');
+                scan.blanks();
+
+                // optionally followed by anything in parentheses
+                if (scan.atEnd()
+                    || (scan.end() - scan.begin() >= 2 && scan.peek() == '(' && scan.end()[-1] == ')')) {
+                    return AttributesSignatureKeyword;
+                }
+            }
+            break;
+
+        case 'P':
+        case 'p':
+            if (scan.keyword("parameter")) {
+                scan.optional('s');
+                return scan.onlyBlanks() ? ParametersSignatureKeyword : NoSignatureKeyword;
+            } else if (scan.keyword("properties") && scan.onlyBlanks()) {
+                return PropertyMembersSignatureKeyword;
+            }
+            break;
+
+        case 'V':
+        case 'v':
+            if (scan.keyword("values") && scan.onlyBlanks())
+                return ValuesSignatureKeyword;
+            break;
+
+        case 'R':
+        case 'r':
+            if (scan.keyword("relation")) {
+                scan.blanks();
+                return scan.peek() == ':' ? RelationSignatureKeyword : NoSignatureKeyword;
+            } else if (scan.keyword("request")) {
+                return RequestSignatureKeyword;
+            } else if (scan.keyword("response")) {
+                return ResponseSignatureKeyword;
+            }
+            break;
+
+        case 'D':
+        case 'd':
+            if (scan.keyword("default")) {
+                scan.blanks();
+                return (scan.atEnd() || scan.peek() == ':') ? DefaultSignatureKeyword : NoSignatureKeyword;
+            } else if (scan.keyword("data") && scan.blanks() && scan.keyword("structure")) {
+                scan.optional('s');
+                return scan.onlyBlanks() ? DataStructuresSignatureKeyword : NoSignatureKeyword;
+            }
+            break;
+
+        case 'I':
+        case 'i':
+            if (scan.keyword("items")) {
+                return scan.onlyBlanks() ? ValueMembersSignatureKeyword : NoSignatureKeyword;
+            } else if (scan.keyword("include") && scan.blanks()) {
+                return IncludeSignatureKeyword;
+            }
+            break;
+
+        case 'M':
+        case 'm':
+            if (scan.keyword("members") && scan.onlyBlanks())
+                return ValueMembersSignatureKeyword;
+            break;
+
+        case 'O':
+        case 'o':
+            if (scan.keyword("one") && scan.blanks() && scan.keyword("of") && scan.onlyBlanks())
+                return OneOfSignatureKeyword;
+            break;
+
+        case 'G':
+        case 'g':
+            // blanks followed by a name, neither containing brackets or parentheses
+            if (scan.keyword("group") && scan.end() - scan.begin() >= 2 && IsBlank(scan.peek())
+                && std::find_if(scan.begin(), scan.end(), IsBracket) == scan.end()) {
+                return GroupSignatureKeyword;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    return NoSignatureKeyword;
+}
+
+bool snowcrash::IsModelSignature(const mdp::ByteBuffer& subject)
+{
+    KeywordScanner scan(subject);
+
+    const char* const begin = scan.begin();
+    const char* const end = scan.end();
+
+    // an identifier may precede the keyword, it must be separated by blanks
+    const char* const firstNonBlank = std::find_if_not(begin, end, IsBlank);
+    const char* const firstBracket = std::find_if(begin, end, IsBracket);
+
+    for (const char* it = begin; end - it >= 5; ++it) {
+
+        if ((*it != 'M' && *it != 'm') || std::memcmp(it + 1, "odel", 4) != 0)
+            continue;
+
+        if (it > firstNonBlank && (it > firstBracket || !IsBlank(it[-1])))
+            continue;
+
+        // optionally followed by a media type in parentheses
+        const char* tail = std::find_if_not(it + 5, end, IsBlank);
+
+        if (tail != end && *tail == '(') {
+            tail = std::find(tail, end, ')');
+
+            if (tail == end)
+                continue;
+
+            tail = std::find_if_not(tail + 1, end, IsBlank);
+        }
+
+        if (tail == end)
+            return true;
+    }
+
+    return false;
 }
 
 #undef TYPECHECK
@@ -28,6 +28,48 @@ namespace snowcrash
      *  \return SectionType Type of the section if the line contains a keyword
      */
     extern SectionType RecognizeCodeBlockFirstLine(const mdp::ByteBuffer& subject);
+
+    /**
+     *  Keyword a section signature starts with
+     */
+    enum SignatureKeyword
+    {
+        NoSignatureKeyword = 0,
+        HeadersSignatureKeyword,         /// < `Header(s)`, see HeadersRegex
+        BodySignatureKeyword,            /// < `Body`, see BodyRegex
+        SchemaSignatureKeyword,          /// < `Schema`, see SchemaRegex
+        AttributesSignatureKeyword,      /// < `Attribute(s) (...)`, see AttributesRegex
+        ParametersSignatureKeyword,      /// < `Parameter(s)`, see ParametersRegex
+        ValuesSignatureKeyword,          /// < `Values`, see ValuesRegex
+        RelationSignatureKeyword,        /// < `Relation: ...`, see RelationRegex
+        RequestSignatureKeyword,         /// < `Request ...`, see RequestRegex
+        ResponseSignatureKeyword,        /// < `Response ...`, see ResponseRegex
+        DefaultSignatureKeyword,         /// < `Default: ...`, see MSONDefaultTypeSectionRegex
+        SampleSignatureKeyword,          /// < `Sample: ...`, see MSONSampleTypeSectionRegex
+        ValueMembersSignatureKeyword,    /// < `Items` or `Members`, see MSONValueMembersTypeSectionRegex
+        PropertyMembersSignatureKeyword, /// < `Properties`, see MSONPropertyMembersTypeSectionRegex
+        OneOfSignatureKeyword,           /// < `One Of`, see MSONOneOfRegex
+        IncludeSignatureKeyword,         /// < `Include ...`, see MSONMixinRegex
+        DataStructuresSignatureKeyword,  /// < `Data Structure(s)`, see DataStructureGroupRegex
+        GroupSignatureKeyword            /// < `Group <name>`, see GroupHeaderRegex
+    };
+
+    /**
+     *  \brief Recognize the keyword of a signature in a single scan
+     *
+     *  Accepts exactly what the respective keyword regex matches, a subject
+     *  matches at most one of them.
+     *
+     *  \param subject  The signature to recognize, usually a trimmed first line
+     *  \return Keyword of the signature, NoSignatureKeyword if it has none
+     */
+    extern SignatureKeyword RecognizeSignatureKeyword(const mdp::ByteBuffer& subject);
+
+    /**
+     *  \brief Recognize a resource model signature, `[<identifier>] Model [(<media type>)]`
+     *  \return True if the subject matches ModelRegex
+     */
+    extern bool IsModelSignature(const mdp::ByteBuffer& subject);
 }
 
 namespace scpl
@@ -16,6 +16,21 @@
 namespace snowcrash
 {
 
+    /**
+     *  \brief  Location of an annotation in bytes of the source data.
+     *
+     *  Parsers annotate Markdown nodes, whose source maps are byte ranges.
+     *  An annotation created with this location keeps the byte ranges until
+     *  its report is complete, see Report::resolveLocations().
+     */
+    struct SourceBytesLocation {
+
+        explicit SourceBytesLocation(const mdp::BytesRangeSet& ranges_) : ranges(ranges_) {}
+
+        /** Byte ranges, must outlive the location */
+        const mdp::BytesRangeSet& ranges;
+    };
+
     /**
      *  \brief  A source data annotation.
      *
@@ -34,7 +49,7 @@ namespace snowcrash
          *
          *  Creates an empty annotation with the default annotation code.
          */
-        SourceAnnotation() : code(OK) {}
+        SourceAnnotation() : code(OK), locationInBytes(false) {}
 
         /**
          *  \brief  %SourceAnnotation copy constructor.
@@ -46,6 +61,7 @@ namespace snowcrash
             this->message = rhs.message;
             this->code = rhs.code;
             this->location = rhs.location;
+            this->locationInBytes = rhs.locationInBytes;
         }
 
         /**
@@ -57,6 +73,7 @@ namespace snowcrash
         SourceAnnotation(const std::string& message,
             int code = OK,
             const mdp::CharactersRangeSet& location = mdp::CharactersRangeSet())
+            : locationInBytes(false)
         {
 
             this->message = message;
@@ -67,6 +84,17 @@ namespace snowcrash
                 this->location.assign(location.begin(), location.end());
         }
 
+        /**
+         *  \brief  %SourceAnnotation constructor.
+         *  \param  message     An annotation message.
+         *  \param  code        Annotation code.
+         *  \param  location    A location of the annotation in bytes, to be resolved.
+         */
+        SourceAnnotation(const std::string& message, int code, const SourceBytesLocation& location)
+            : location(location.ranges), code(code), message(message), locationInBytes(true)
+        {
+        }
+
         /** \brief  %SourceAnnotation destructor. */
         ~SourceAnnotation() {}
 
@@ -79,9 +107,23 @@ namespace snowcrash
             this->message = rhs.message;
             this->code = rhs.code;
             this->location = rhs.location;
+            this->locationInBytes = rhs.locationInBytes;
             return *this;
         }
 
+        /**
+         *  \brief  Convert a location in bytes to characters
+         *  \param  index   Character index of the annotated source data.
+         */
+        void resolveLocation(const mdp::ByteBufferCharacterIndex& index)
+        {
+            if (!locationInBytes)
+                return;
+
+            location = mdp::BytesRangeSetToCharactersRangeSet(location, index);
+            locationInBytes = false;
+        }
+
         /** The location of this annotation within the source data buffer. */
         mdp::CharactersRangeSet location;
 
@@ -90,6 +132,9 @@ namespace snowcrash
 
         /** A annotation message. */
         std::string message;
+
+        /** True if the location is in bytes, until it is resolved. */
+        bool locationInBytes;
     };
 
     /**
@@ -106,7 +151,9 @@ namespace snowcrash
         ApplicationError = 1,
         BusinessError = 2,
         ModelError = 3,
-        MSONError = 4
+        MSONError = 4,
+        LimitError = 5,       /// A limit on the work of the parser was exceeded
+        CancellationError = 6 /// The parse was cancelled
     };
 
     /**
@@ -161,6 +208,22 @@ namespace snowcrash
             return *this;
         }
 
+        /**
+         *  \brief Convert locations in bytes of all annotations to characters
+         *
+         *  Done once the report is complete, so annotations which are dropped
+         *  while parsing never pay for the conversion.
+         *
+         *  NOTE: A binding does not need to wrap this action.
+         */
+        void resolveLocations(const mdp::ByteBufferCharacterIndex& index)
+        {
+            error.resolveLocation(index);
+
+            for (Warnings::iterator it = warnings.begin(); it != warnings.end(); ++it)
+                it->resolveLocation(index);
+        }
+
         /** Result error source annotation */
         Error error;
 
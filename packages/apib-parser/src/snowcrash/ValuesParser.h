@@ -57,8 +57,7 @@ namespace snowcrash
                     ss << "ignoring the '" << content << "' element";
                     ss << ", expected '`" << content << "`'";
 
-                    mdp::CharactersRangeSet sourceMap
-                        = mdp::BytesRangeSetToCharactersRangeSet(node->sourceMap, pd.sourceCharacterIndex);
+                    SourceBytesLocation sourceMap(node->sourceMap);
                     out.report.warnings.push_back(Warning(ss.str(), IgnoringWarning, sourceMap));
                 }
 
@@ -78,7 +77,7 @@ namespace snowcrash
                 mdp::ByteBuffer subject = node->children().front().text;
                 TrimString(subject);
 
-                if (RegexMatch(subject, ValuesRegex)) {
+                if (RecognizeSignatureKeyword(subject) == ValuesSignatureKeyword) {
                     return ValuesSectionType;
                 }
             }
@@ -8,8 +8,58 @@
 
 #include <regex.h>
 #include <cstring>
+#include <memory>
+#include <unordered_map>
 #include "../RegexMatch.h"
 
+namespace
+{
+    class CompiledRegex
+    {
+        regex_t m_regex;
+        bool m_compiled;
+
+    public:
+        CompiledRegex(const std::string& expression, int flags)
+            : m_compiled(::regcomp(&m_regex, expression.c_str(), flags) == 0)
+        {
+        }
+
+        ~CompiledRegex()
+        {
+            if (m_compiled)
+                ::regfree(&m_regex);
+        }
+
+        CompiledRegex(const CompiledRegex&) = delete;
+        CompiledRegex& operator=(const CompiledRegex&) = delete;
+
+        const regex_t* get() const
+        {
+            return m_compiled ? &m_regex : NULL;
+        }
+    };
+
+    typedef std::unordered_map<std::string, std::unique_ptr<CompiledRegex> > RegexCache;
+
+    // The parser matches against a fixed set of expressions; compiling each
+    // once per thread keeps it warm across documents without locking.
+    // Returns NULL if the expression does not compile.
+    const regex_t* Compile(const std::string& expression, int flags)
+    {
+        thread_local RegexCache matchCache;
+        thread_local RegexCache captureCache;
+
+        RegexCache& cache = (flags & REG_NOSUB) ? matchCache : captureCache;
+
+        RegexCache::iterator it = cache.find(expression);
+        if (it == cache.end())
+            it = cache.emplace(expression, std::unique_ptr<CompiledRegex>(new CompiledRegex(expression, flags))).first;
+
+        return it->second->get();
+    }
+}
+
 // FIXME: Migrate to C++11.
 // Naive implementation of regex matching using POSIX regex
 bool snowcrash::RegexMatch(const std::string& target, const std::string& expression)
@@ -17,29 +67,14 @@ bool snowcrash::RegexMatch(const std::string& target, const std::string& express
     if (target.empty() || expression.empty())
         return false;
 
-    regex_t regex;
-    int reti = ::regcomp(&regex, expression.c_str(), REG_EXTENDED | REG_NOSUB);
-    if (reti) {
+    const regex_t* regex = Compile(expression, REG_EXTENDED | REG_NOSUB);
+    if (!regex) {
         // Unable to compile regex
         return false;
     }
 
     // Execute regular expression
-    reti = ::regexec(&regex, target.c_str(), 0, NULL, 0);
-    if (!reti) {
-        ::regfree(&regex);
-        return true;
-    } else if (reti == REG_NOMATCH) {
-        ::regfree(&regex);
-        return false;
-    } else {
-        char msgbuf[1024];
-        regerror(reti, &regex, msgbuf, sizeof(msgbuf));
-        ::regfree(&regex);
-        return false;
-    }
-
-    return false;
+    return ::regexec(regex, target.c_str(), 0, NULL, 0) == 0;
 }
 
 std::string snowcrash::RegexCaptureFirst(const std::string& target, const std::string& expression)
@@ -60,18 +95,15 @@ bool snowcrash::RegexCapture(
     captureGroups.clear();
 
     try {
-        regex_t regex;
-        int reti = ::regcomp(&regex, expression.c_str(), REG_EXTENDED);
-        if (reti)
+        const regex_t* regex = Compile(expression, REG_EXTENDED);
+        if (!regex)
             return false;
 
         regmatch_t* pmatch = ::new regmatch_t[groupSize];
         ::memset(pmatch, 0, sizeof(regmatch_t) * groupSize);
 
-        reti = ::regexec(&regex, target.c_str(), groupSize, pmatch, 0);
+        int reti = ::regexec(regex, target.c_str(), groupSize, pmatch, 0);
         if (!reti) {
-            ::regfree(&regex);
-
             for (size_t i = 0; i < groupSize; ++i) {
                 if (pmatch[i].rm_so == -1 || pmatch[i].rm_eo == -1)
                     captureGroups.push_back(std::string());
@@ -82,7 +114,6 @@ bool snowcrash::RegexCapture(
             delete[] pmatch;
             return true;
         } else {
-            ::regfree(&regex);
             delete[] pmatch;
             return false;
         }
@@ -51,27 +51,34 @@ static bool CheckSource(const mdp::ByteBuffer& source, Report& report)
 int snowcrash::parse(
     const mdp::ByteBuffer& source, BlueprintParserOptions options, const ParseResultRef<Blueprint>& out)
 {
-    try {
+    Parser parser;
+    return parser.parse(source, options, out);
+}
+
+int Parser::parse(const mdp::ByteBuffer& source, BlueprintParserOptions options, const ParseResultRef<Blueprint>& out)
+{
+    // Reuse the character index storage
+    SectionParserData pd(options, source, out.node);
+    pd.sourceCharacterIndex.swap(m_characterIndex);
+    pd.sourceCharacterIndex.clear();
+    pd.concurrency = m_concurrency;
+    pd.progress = m_progress ? &m_progress : nullptr;
 
-        // Sanity Check
-        if (!CheckSource(source, out.report))
-            return out.report.error.code;
+    try {
 
-        // Do nothing if blueprint is empty
-        if (source.empty())
-            return out.report.error.code;
+        // Sanity Check, do nothing if blueprint is empty
+        if (CheckSource(source, out.report) && !source.empty()) {
 
-        // Parse Markdown
-        mdp::MarkdownParser markdownParser;
-        mdp::MarkdownNode markdownAST;
-        markdownParser.parse(source, markdownAST);
+            // Parse Markdown
+            mdp::MarkdownNode markdownAST;
+            m_markdownParser.parse(source, markdownAST);
 
-        // Build SectionParserData
-        SectionParserData pd(options, source, out.node);
-        mdp::BuildCharacterIndex(pd.sourceCharacterIndex, source);
+            mdp::BuildCharacterIndex(pd.sourceCharacterIndex, source);
 
-        // Parse Blueprint
-        BlueprintParser::parse(markdownAST.children().begin(), markdownAST.children(), pd, out);
+            // Parse Blueprint, classifying each node once
+            SectionTypeCache::Scope sectionTypes(m_sectionTypes);
+            BlueprintParser::parse(markdownAST.children().begin(), markdownAST.children(), pd, out);
+        }
     } catch (const Error& e) {
         out.report.error = e;
     } catch (const std::exception& e) {
@@ -83,5 +90,19 @@ int snowcrash::parse(
         out.report.error = Error("parser exception has occurred", ApplicationError);
     }
 
+    // Annotations are located in bytes while parsing
+    out.report.resolveLocations(pd.sourceCharacterIndex);
+    pd.sourceCharacterIndex.swap(m_characterIndex);
+
     return out.report.error.code;
 }
+
+void Parser::setConcurrency(unsigned threads)
+{
+    m_concurrency = threads;
+}
+
+void Parser::setProgressCallback(ProgressCallback callback)
+{
+    m_progress = std::move(callback);
+}
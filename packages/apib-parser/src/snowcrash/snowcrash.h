@@ -12,6 +12,7 @@
 #include "BlueprintSourcemap.h"
 #include "SourceAnnotation.h"
 #include "SectionParser.h"
+#include "MarkdownParser.h"
 
 /**
  *  API Blueprint Parser Interface
@@ -38,6 +39,52 @@ namespace snowcrash
      *  \return Error status code. Zero represents success, non-zero a failure.
      */
     int parse(const mdp::ByteBuffer& source, BlueprintParserOptions options, const ParseResultRef<Blueprint>& out);
+
+    /**
+     *  \brief Reusable API Blueprint parser
+     *
+     *  Keeps the Markdown renderer and working buffers between documents,
+     *  sparing their setup when parsing many of them. An instance must not
+     *  be used by several threads at once.
+     */
+    class Parser
+    {
+    public:
+        /**
+         *  \brief Parse the source data into a blueprint abstract source tree (AST).
+         *
+         *  \see snowcrash::parse
+         */
+        int parse(const mdp::ByteBuffer& source, BlueprintParserOptions options, const ParseResultRef<Blueprint>& out);
+
+        /**
+         *  \brief Set the number of threads top-level sections may be parsed with.
+         *
+         *  Sections are parsed on the calling thread only with zero or one, the
+         *  default. The result does not depend on the number of threads.
+         */
+        void setConcurrency(unsigned threads);
+
+        /**
+         *  \brief Set the callback polled as parsing advances, see %ProgressCallback.
+         *
+         *  A parse the callback cancels ends with an error of %CancellationError code.
+         *  An empty callback, the default, is not polled.
+         *
+         *  With setConcurrency() above one the callback is called from several
+         *  threads at once and must be thread-safe. Its offsets are then not
+         *  monotonic: sections parsed ahead and discarded are parsed again on
+         *  the calling thread, reporting their earlier offsets once more.
+         */
+        void setProgressCallback(ProgressCallback callback);
+
+    private:
+        mdp::MarkdownParser m_markdownParser;
+        mdp::ByteBufferCharacterIndex m_characterIndex;
+        SectionTypeCache m_sectionTypes;
+        unsigned m_concurrency = 0;
+        ProgressCallback m_progress;
+    };
 }
 
 #endif
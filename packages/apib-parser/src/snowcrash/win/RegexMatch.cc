@@ -8,6 +8,7 @@
 
 #include <regex>
 #include <cstring>
+#include <unordered_map>
 #include "../RegexMatch.h"
 
 using namespace std;
@@ -19,14 +20,29 @@ using namespace std::tr1;
 // A C++09 implementation
 //
 
+namespace
+{
+    // Compiled expressions, one cache per thread (see posix/RegexMatch.cc)
+    // Throws regex_error if the expression does not compile.
+    const regex& Compile(const string& expression)
+    {
+        thread_local unordered_map<string, regex> cache;
+
+        unordered_map<string, regex>::iterator it = cache.find(expression);
+        if (it == cache.end())
+            it = cache.emplace(expression, regex(expression, regex_constants::extended)).first;
+
+        return it->second;
+    }
+}
+
 bool snowcrash::RegexMatch(const string& target, const string& expression)
 {
     if (target.empty() || expression.empty())
         return false;
 
     try {
-        regex pattern(expression, regex_constants::extended);
-        return regex_search(target, pattern);
+        return regex_search(target, Compile(expression));
     } catch (const regex_error&) {
     } catch (...) {
     }
@@ -53,9 +69,8 @@ bool snowcrash::RegexCapture(
 
     try {
 
-        regex pattern(expression, regex_constants::extended);
         match_results<string::const_iterator> result;
-        if (!regex_search(target, result, pattern))
+        if (!regex_search(target, result, Compile(expression)))
             return false;
 
         for (match_results<string::const_iterator>::const_iterator it = result.begin(); it != result.end(); ++it) {
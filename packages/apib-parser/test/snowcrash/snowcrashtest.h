@@ -65,9 +65,10 @@ namespace snowcrashtest
             pd.modelSourceMapTable.insert(models.modelSourceMapTable.begin(), models.modelSourceMapTable.end());
 
             pd.namedTypeBaseTable.insert(namedTypes.baseTable.begin(), namedTypes.baseTable.end());
-            pd.namedTypeDependencyTable.insert(namedTypes.dependencyTable.begin(), namedTypes.dependencyTable.end());
+            pd.namedTypeDependencyTable = namedTypes.dependencyTable;
 
             PARSER::parse(markdownAST.children().begin(), markdownAST.children(), pd, out);
+            out.report.resolveLocations(pd.sourceCharacterIndex);
         }
 
         static void parseMSON(const mdp::ByteBuffer& source,
@@ -111,7 +112,7 @@ namespace snowcrashtest
         {
 
             namedTypes.baseTable[literal] = baseType;
-            namedTypes.dependencyTable[literal] = std::set<mson::Literal>();
+            namedTypes.dependencyTable.declare(literal);
         }
     };
 
@@ -735,6 +735,24 @@ TEST_CASE("Report error when data Structure inheritance graph with only a few of
     SourceMapHelper::check(blueprint.report.error.location, 37, 9);
 }
 
+TEST_CASE("Report error when a long data structure inheritance chain ends in a cycle", "[blueprint]")
+{
+    // T0 (T1), T1 (T2), ... T999 (T500)
+    mdp::ByteBuffer source = "# Data Structures\n\n";
+
+    for (int i = 0; i < 1000; ++i) {
+        source += "## T" + std::to_string(i) + " (T" + std::to_string(i < 999 ? i + 1 : 500) + ")\n";
+    }
+
+    ParseResult<Blueprint> blueprint;
+    SectionParserHelper<Blueprint, BlueprintParser>::parse(
+        source, BlueprintSectionType, blueprint, ExportSourcemapOption);
+
+    REQUIRE(blueprint.report.error.code == MSONError);
+    REQUIRE(blueprint.report.error.message == "base type 'T500' circularly referencing itself");
+    SourceMapHelper::check(blueprint.report.error.location, source.find("## T500 "), 15);
+}
+
 TEST_CASE("Do not report error when named sub type is referenced in nested members", "[blueprint]")
 {
     mdp::ByteBuffer source
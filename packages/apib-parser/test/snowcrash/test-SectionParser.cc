@@ -90,3 +90,40 @@ TEST_CASE("List adapter with Header section", "[adapter]")
 
     REQUIRE_THROWS_AS(ListSectionAdapter::startingNode(markdownAST.children().begin(), pd), Error);
 }
+
+TEST_CASE("Section types are classified once while a cache is in scope", "[section_type_cache]")
+{
+    mdp::MarkdownParser markdownParser;
+    mdp::MarkdownNode markdownAST;
+    markdownParser.parse(ListSectionFixture, markdownAST);
+
+    REQUIRE(!markdownAST.children().empty());
+
+    const mdp::MarkdownNode& node = markdownAST.children().front();
+    static const char classifier = 0;
+    int calls = 0;
+
+    auto classify = [&calls]() {
+        ++calls;
+        return HeadersSectionType;
+    };
+
+    REQUIRE(SectionTypeCache::lookup(node, &classifier, classify) == HeadersSectionType);
+    REQUIRE(SectionTypeCache::lookup(node, &classifier, classify) == HeadersSectionType);
+    REQUIRE(calls == 2);
+
+    {
+        SectionTypeCache cache;
+        SectionTypeCache::Scope scope(cache);
+
+        REQUIRE(SectionTypeCache::lookup(node, &classifier, classify) == HeadersSectionType);
+        REQUIRE(SectionTypeCache::lookup(node, &classifier, classify) == HeadersSectionType);
+        REQUIRE(calls == 3);
+
+        REQUIRE(SectionKeywordSignature(markdownAST.children().begin())
+            == SectionKeywordSignature(markdownAST.children().begin()));
+    }
+
+    REQUIRE(SectionTypeCache::lookup(node, &classifier, classify) == HeadersSectionType);
+    REQUIRE(calls == 4);
+}
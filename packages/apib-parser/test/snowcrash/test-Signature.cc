@@ -7,6 +7,18 @@
 //
 
 #include "snowcrashtest.h"
+#include "AssetParser.h"
+#include "AttributesParser.h"
+#include "DataStructureGroupParser.h"
+#include "HeadersParser.h"
+#include "MSONMixinParser.h"
+#include "MSONOneOfParser.h"
+#include "MSONTypeSectionParser.h"
+#include "ParametersParser.h"
+#include "PayloadParser.h"
+#include "RelationParser.h"
+#include "ResourceGroupParser.h"
+#include "ValuesParser.h"
 
 static const mdp::ByteBuffer PropertySignatureFixture = "id: 42 (yes, no) - a good message";
 static const mdp::ByteBuffer EscapedPropertySignatureFixture = "`*id*(data):3`: `42` (yes, no) - a good message";
@@ -536,3 +548,90 @@ TEST_CASE("Identifier with an underscore", "[signature]")
     REQUIRE(signature.content.empty());
     REQUIRE(signature.remainingContent.empty());
 }
+
+namespace
+{
+    struct KeywordRegex {
+        SignatureKeyword keyword;
+        const char* regex;
+    };
+
+    const KeywordRegex KeywordRegexes[] = {
+        { HeadersSignatureKeyword, HeadersRegex },
+        { BodySignatureKeyword, BodyRegex },
+        { SchemaSignatureKeyword, SchemaRegex },
+        { AttributesSignatureKeyword, AttributesRegex },
+        { ParametersSignatureKeyword, ParametersRegex },
+        { ValuesSignatureKeyword, ValuesRegex },
+        { RelationSignatureKeyword, RelationRegex },
+        { RequestSignatureKeyword, RequestRegex },
+        { ResponseSignatureKeyword, ResponseRegex },
+        { DefaultSignatureKeyword, MSONDefaultTypeSectionRegex },
+        { SampleSignatureKeyword, MSONSampleTypeSectionRegex },
+        { ValueMembersSignatureKeyword, MSONValueMembersTypeSectionRegex },
+        { PropertyMembersSignatureKeyword, MSONPropertyMembersTypeSectionRegex },
+        { OneOfSignatureKeyword, MSONOneOfRegex },
+        { IncludeSignatureKeyword, MSONMixinRegex },
+        { DataStructuresSignatureKeyword, DataStructureGroupRegex },
+        { GroupSignatureKeyword, GroupHeaderRegex },
+    };
+
+    SignatureKeyword RegexSignatureKeyword(const mdp::ByteBuffer& subject)
+    {
+        SignatureKeyword result = NoSignatureKeyword;
+
+        for (const auto& candidate : KeywordRegexes) {
+            if (RegexMatch(subject, candidate.regex)) {
+                REQUIRE(result == NoSignatureKeyword);
+                result = candidate.keyword;
+            }
+        }
+
+        return result;
+    }
+}
+
+TEST_CASE("Signature keywords", "[signature][keyword]")
+{
+    REQUIRE(RecognizeSignatureKeyword("Headers") == HeadersSignatureKeyword);
+    REQUIRE(RecognizeSignatureKeyword("  header ") == HeadersSignatureKeyword);
+    REQUIRE(RecognizeSignatureKeyword("HEADERS") == NoSignatureKeyword);
+    REQUIRE(RecognizeSignatureKeyword("Attributes (object)") == AttributesSignatureKeyword);
+    REQUIRE(RecognizeSignatureKeyword("Attributes object") == NoSignatureKeyword);
+    REQUIRE(RecognizeSignatureKeyword("Request Create (application/json)") == RequestSignatureKeyword);
+    REQUIRE(RecognizeSignatureKeyword("Response 200") == ResponseSignatureKeyword);
+    REQUIRE(RecognizeSignatureKeyword("Relation: self") == RelationSignatureKeyword);
+    REQUIRE(RecognizeSignatureKeyword("Default: 42") == DefaultSignatureKeyword);
+    REQUIRE(RecognizeSignatureKeyword("Include Person") == IncludeSignatureKeyword);
+    REQUIRE(RecognizeSignatureKeyword("Include") == NoSignatureKeyword);
+    REQUIRE(RecognizeSignatureKeyword("one of") == OneOfSignatureKeyword);
+    REQUIRE(RecognizeSignatureKeyword("Data Structures") == DataStructuresSignatureKeyword);
+    REQUIRE(RecognizeSignatureKeyword("Group Users") == GroupSignatureKeyword);
+    REQUIRE(RecognizeSignatureKeyword("Group Users [/users]") == NoSignatureKeyword);
+    REQUIRE(RecognizeSignatureKeyword("") == NoSignatureKeyword);
+
+    REQUIRE(IsModelSignature("Model"));
+    REQUIRE(IsModelSignature("User Model (application/json)"));
+    REQUIRE(!IsModelSignature("Models"));
+    REQUIRE(!IsModelSignature("[User] Model"));
+}
+
+TEST_CASE("Signature keywords are recognized as by their regexes", "[signature][keyword]")
+{
+    const char* const fragments[] = { "", " ", "\t", "Header", "headers", "HEADER", "s", "Body", "Schema", "sample",
+        "Attributes", "(", ")", "(x)", "Parameter", "Properties", "Values", "Relation", ":", "Request", "response",
+        "200", "Default", "data", "Structure", "Items", "Members", "include", "One", "of", "Group", "[", "]", "Model",
+        "odel", "application/json", "\n", "x" };
+
+    for (const char* first : fragments) {
+        for (const char* second : fragments) {
+            for (const char* third : fragments) {
+                const mdp::ByteBuffer subject = mdp::ByteBuffer(first) + second + third;
+
+                INFO("subject: '" << subject << "'");
+                REQUIRE(RecognizeSignatureKeyword(subject) == RegexSignatureKeyword(subject));
+                REQUIRE(IsModelSignature(subject) == RegexMatch(subject, ModelRegex));
+            }
+        }
+    }
+}
@@ -299,6 +299,23 @@ TEST_CASE("Invalid source map without closing newline", "[regression][parser]")
     SourceMapHelper::check(blueprint.report.warnings[0].location, 0, 13);
 }
 
+TEST_CASE("Annotation locations are in characters", "[parser][sourcemap]")
+{
+    mdp::ByteBuffer source
+        = "# \xC5\x87am\xC3\xA9\n"
+          "\n"
+          "# PUT /branch";
+
+    ParseResult<Blueprint> blueprint;
+
+    REQUIRE_NOTHROW(parse(source, 0, blueprint));
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(blueprint.report.warnings.size() == 1);
+    REQUIRE(blueprint.report.warnings[0].code == EmptyDefinitionWarning);
+    REQUIRE(!blueprint.report.warnings[0].locationInBytes);
+    SourceMapHelper::check(blueprint.report.warnings[0].location, 8, 13);
+}
+
 TEST_CASE("Warn about missing API name if there is an API description", "[parser][regression]")
 {
     mdp::ByteBuffer source1 = "Hello World\n";
@@ -761,3 +778,170 @@ TEST_CASE("Parse blueprint with mismatched adapter blocks", "[blueprint]")
     REQUIRE(blueprint.report.warnings.empty());
     SourceMapHelper::check(blueprint.report.error.location, 42, 24);
 }
+
+TEST_CASE("Parse top-level sections concurrently", "[parser][concurrency]")
+{
+    mdp::ByteBuffer groups
+        = "# API\n\n"
+          "# Group A\n\n"
+          "## Note [/notes/{id}]\n\n"
+          "+ Attributes (Item)\n\n"
+          "### Get [GET]\n\n"
+          "+ Response 200\n\n"
+          "    [Thing][]\n\n"
+          "# Group B\n\n"
+          "## Thing [/thing]\n\n"
+          "+ Model (text/plain)\n\n"
+          "        thing\n\n"
+          "### Get [GET]\n\n"
+          "+ Response 200\n\n"
+          "    [Thing][]\n\n"
+          "# Data Structures\n\n"
+          "## Item (object)\n\n"
+          "+ id: 1 (number)\n"
+          "+ tags (array[Tag])\n\n"
+          "## Tag (object)\n\n"
+          "+ Include Item\n\n";
+
+    // A group and a resource defined again, and a model referenced once it is defined
+    mdp::ByteBuffer conflicts = groups + "# Group A\n\n## Again [/thing]\n\n### Get [GET]\n\n+ Response 200\n\n    [Thing][]\n";
+
+    for (const mdp::ByteBuffer& source : { groups, conflicts }) {
+
+        ParseResult<Blueprint> sequential;
+        parse(source, ExportSourcemapOption, sequential);
+
+        for (unsigned threads : { 2, 3, 4 }) {
+
+            snowcrash::Parser parser;
+            parser.setConcurrency(threads);
+
+            ParseResult<Blueprint> concurrent;
+            parser.parse(source, ExportSourcemapOption, concurrent);
+
+            REQUIRE(concurrent.report.error.code == sequential.report.error.code);
+            REQUIRE(concurrent.report.error.message == sequential.report.error.message);
+            REQUIRE(concurrent.report.warnings.size() == sequential.report.warnings.size());
+
+            for (size_t i = 0; i < sequential.report.warnings.size(); ++i) {
+                REQUIRE(concurrent.report.warnings[i].code == sequential.report.warnings[i].code);
+                REQUIRE(concurrent.report.warnings[i].message == sequential.report.warnings[i].message);
+            }
+
+            const Elements& expected = sequential.node.content.elements();
+            const Elements& elements = concurrent.node.content.elements();
+
+            REQUIRE(elements.size() == expected.size());
+            REQUIRE(concurrent.sourceMap.content.elements().collection.size()
+                == sequential.sourceMap.content.elements().collection.size());
+
+            for (size_t i = 0; i < expected.size(); ++i) {
+                REQUIRE(elements[i].category == expected[i].category);
+                REQUIRE(elements[i].attributes.name == expected[i].attributes.name);
+                REQUIRE(elements[i].content.elements().size() == expected[i].content.elements().size());
+
+                for (size_t j = 0; j < expected[i].content.elements().size(); ++j) {
+                    const Element& element = elements[i].content.elements()[j];
+                    const Element& expectedElement = expected[i].content.elements()[j];
+
+                    REQUIRE(element.element == expectedElement.element);
+                    REQUIRE(element.content.resource.uriTemplate == expectedElement.content.resource.uriTemplate);
+                    REQUIRE(element.content.dataStructure.name.symbol.literal
+                        == expectedElement.content.dataStructure.name.symbol.literal);
+
+                    const Actions& actions = element.content.resource.actions;
+                    const Actions& expectedActions = expectedElement.content.resource.actions;
+
+                    REQUIRE(actions.size() == expectedActions.size());
+
+                    for (size_t k = 0; k < expectedActions.size(); ++k) {
+                        const Response& response = actions[k].examples[0].responses[0];
+                        const Response& expectedResponse = expectedActions[k].examples[0].responses[0];
+
+                        REQUIRE(response.reference.meta.state == expectedResponse.reference.meta.state);
+                        REQUIRE(response.body == expectedResponse.body);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Report parsing progress and cancel the parse", "[parser][progress]")
+{
+    mdp::ByteBuffer source
+        = "# API\n\n"
+          "# Group A\n\n"
+          "## First [/first]\n\n"
+          "### Get [GET]\n\n"
+          "+ Response 200\n\n"
+          "# Group B\n\n"
+          "## Second [/second]\n\n"
+          "### Get [GET]\n\n"
+          "+ Response 200\n\n"
+          "+ Response 404\n\n";
+
+    std::vector<size_t> offsets;
+
+    snowcrash::Parser parser;
+    parser.setProgressCallback([&offsets](size_t offset) {
+        offsets.push_back(offset);
+        return true;
+    });
+
+    ParseResult<Blueprint> blueprint;
+    parser.parse(source, ExportSourcemapOption, blueprint);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    // two groups, two resources and three responses
+    REQUIRE(offsets.size() == 7);
+    REQUIRE(std::is_sorted(offsets.begin(), offsets.end()));
+    REQUIRE(offsets.back() >= source.find("+ Response 404"));
+    REQUIRE(offsets.back() < source.size());
+
+    SECTION("Cancel at the second resource")
+    {
+        const size_t second = source.find("## Second");
+
+        parser.setProgressCallback([second](size_t offset) { return offset < second; });
+
+        ParseResult<Blueprint> cancelled;
+        parser.parse(source, ExportSourcemapOption, cancelled);
+
+        REQUIRE(cancelled.report.error.code == CancellationError);
+    }
+
+    SECTION("Cancel top-level sections parsed concurrently")
+    {
+        parser.setConcurrency(2);
+        parser.setProgressCallback([](size_t offset) { return false; });
+
+        ParseResult<Blueprint> cancelled;
+        parser.parse(source, ExportSourcemapOption, cancelled);
+
+        REQUIRE(cancelled.report.error.code == CancellationError);
+    }
+
+    SECTION("End the parse with an error of the callback")
+    {
+        parser.setProgressCallback([](size_t offset) -> bool { throw Error("out of time", LimitError); });
+
+        ParseResult<Blueprint> stopped;
+        parser.parse(source, ExportSourcemapOption, stopped);
+
+        REQUIRE(stopped.report.error.code == LimitError);
+        REQUIRE(stopped.report.error.message == "out of time");
+    }
+
+    SECTION("No callback")
+    {
+        parser.setProgressCallback(ProgressCallback());
+
+        ParseResult<Blueprint> uncancelled;
+        parser.parse(source, ExportSourcemapOption, uncancelled);
+
+        REQUIRE(uncancelled.report.error.code == Error::OK);
+        REQUIRE(offsets.size() == 7);
+    }
+}
@@ -0,0 +1,84 @@
+//
+//  ConversionBudget.cc
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "ConversionBudget.h"
+
+#include "SourceAnnotation.h"
+
+#include <sstream>
+
+using namespace drafter;
+
+ConversionBudget::ConversionBudget(const drafter_parse_options* opts, clock::time_point start) noexcept
+    : limits_(get_limits(opts)), deadline_(start + std::chrono::milliseconds(limits_.time_ms))
+{
+}
+
+refract::ExpandLimits ConversionBudget::expandLimits() const
+{
+    refract::ExpandLimits result;
+    result.depth = limits_.expansion_depth;
+
+    if (limits_.expanded_elements) {
+        const std::size_t expanded = expanded_.load(std::memory_order_relaxed);
+
+        // never 0, which would lift the bound
+        result.elements = expanded < limits_.expanded_elements ? limits_.expanded_elements - expanded : 1;
+    }
+
+    if (limits_.time_ms) {
+        result.poll = [this]() { checkTime(); };
+    }
+
+    return result;
+}
+
+refract::GenerationLimits ConversionBudget::generationLimits() const
+{
+    refract::GenerationLimits result;
+    result.size = limits_.asset_size;
+
+    if (limits_.time_ms) {
+        result.poll = [this]() { checkTime(); };
+    }
+
+    return result;
+}
+
+void ConversionBudget::expanded(std::size_t elements)
+{
+    if (!limits_.expanded_elements) {
+        return;
+    }
+
+    if (expanded_.fetch_add(elements, std::memory_order_relaxed) + elements > limits_.expanded_elements) {
+        throw snowcrash::Error("data structures expand into too many elements", snowcrash::LimitError);
+    }
+}
+
+bool ConversionBudget::boundsGeneration() const noexcept
+{
+    return limits_.asset_size || limits_.time_ms;
+}
+
+void ConversionBudget::generated(std::size_t size) const
+{
+    if (limits_.asset_size && size > limits_.asset_size) {
+        std::stringstream msg;
+        msg << "generated asset exceeds " << limits_.asset_size << " bytes";
+        throw snowcrash::Error(msg.str(), snowcrash::LimitError);
+    }
+}
+
+void ConversionBudget::checkTime() const
+{
+    if (limits_.time_ms && clock::now() > deadline_) {
+        std::stringstream msg;
+        msg << "parsing takes longer than " << limits_.time_ms << " ms";
+        throw snowcrash::Error(msg.str(), snowcrash::LimitError);
+    }
+}
@@ -0,0 +1,65 @@
+//
+//  ConversionBudget.h
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef DRAFTER_CONVERSIONBUDGET_H
+#define DRAFTER_CONVERSIONBUDGET_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+#include "refract/ExpandVisitor.h"
+#include "refract/GenerationContext.h"
+#include "options.h"
+
+namespace drafter
+{
+    ///
+    /// Limits on the work of a conversion, see drafter_set_limits
+    ///
+    /// Exceeding a limit throws snowcrash::Error of snowcrash::LimitError
+    /// code, which ends the conversion with an error annotation. Contexts
+    /// converting parts of a document concurrently share one budget.
+    ///
+    class ConversionBudget
+    {
+    public:
+        using clock = std::chrono::steady_clock;
+
+    private:
+        const parse_limits limits_;
+        const clock::time_point deadline_;
+        std::atomic<std::size_t> expanded_{ 0 };
+
+    public:
+        /// Time is measured from given start, e.g. of parsing
+        explicit ConversionBudget(const drafter_parse_options*, clock::time_point start = clock::now()) noexcept;
+
+        ConversionBudget(const ConversionBudget&) = delete;
+        ConversionBudget& operator=(const ConversionBudget&) = delete;
+
+        /// Bounds on the next expansion, counting elements expanded so far
+        refract::ExpandLimits expandLimits() const;
+
+        /// Account for the elements visited by an expansion
+        void expanded(std::size_t elements);
+
+        /// Bounds on the generation of an asset
+        refract::GenerationLimits generationLimits() const;
+
+        /// Whether generating an asset is subject to a limit
+        bool boundsGeneration() const noexcept;
+
+        /// Check the size of a generated asset
+        void generated(std::size_t size) const;
+
+        /// Check the time spent so far
+        void checkTime() const;
+    };
+}
+
+#endif
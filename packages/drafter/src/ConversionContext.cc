@@ -13,26 +13,76 @@
 using namespace drafter;
 
 ConversionContext::ConversionContext(const char* src, const drafter_parse_options* opts, bool expandMson) noexcept
-    : newline_indices_(GetLinesEndIndex(src)),
+    : source_(src),
+      newline_indices_{},
       expand_mson_{ expandMson },
       options_{ opts },
       registry_{},
-      warnings_{}
+      types_{ &registry_ },
+      warnings_{},
+      own_budget_{ opts },
+      budget_{ &own_budget_ },
+      asset_buffer_{},
+      media_types_{}
+{
+}
+
+ConversionContext::ConversionContext(const char* src,
+    const drafter_parse_options* opts,
+    std::string assetBuffer,
+    ConversionBudget::clock::time_point start) noexcept
+    : source_(src),
+      newline_indices_{},
+      expand_mson_{ false },
+      options_{ opts },
+      registry_{},
+      types_{ &registry_ },
+      warnings_{},
+      own_budget_{ opts, start },
+      budget_{ &own_budget_ },
+      asset_buffer_{ std::move(assetBuffer) },
+      media_types_{}
+{
+}
+
+ConversionContext::ConversionContext(ConversionContext& parent, SharedTypes) noexcept
+    : source_(parent.source_),
+      newline_indices_{},
+      newline_indices_owner_{ parent.newline_indices_owner_ },
+      expand_mson_{ parent.expand_mson_ },
+      options_{ parent.options_ },
+      annotations_only_{ parent.annotations_only_ },
+      registry_{},
+      types_{ parent.types_ },
+      warnings_{},
+      own_budget_{ nullptr },
+      budget_{ parent.budget_ },
+      progress_{ parent.progress_ },
+      asset_buffer_{},
+      media_types_{}
 {
 }
 
 refract::Registry& ConversionContext::typeRegistry() noexcept
 {
-    return registry_;
+    return *types_;
 }
 
 const refract::Registry& ConversionContext::typeRegistry() const noexcept
 {
-    return registry_;
+    return *types_;
 }
 
-const NewLinesIndex& ConversionContext::newlineIndices() const noexcept
+const NewLinesIndex& ConversionContext::newlineIndices() const
 {
+    if (newline_indices_owner_ != this)
+        return newline_indices_owner_->newlineIndices();
+
+    // only annotations need line numbers, most documents have none
+    if (!newline_indices_built_) {
+        newline_indices_ = GetLinesEndIndex(source_ ? source_ : "");
+        newline_indices_built_ = true;
+    }
     return newline_indices_;
 }
 
@@ -41,6 +91,46 @@ bool ConversionContext::expandMson() const noexcept
     return expand_mson_;
 }
 
+bool ConversionContext::annotationsOnly() const noexcept
+{
+    return annotations_only_;
+}
+
+void ConversionContext::annotationsOnly(bool value) noexcept
+{
+    annotations_only_ = value;
+}
+
+std::string& ConversionContext::assetBuffer() noexcept
+{
+    return asset_buffer_;
+}
+
+std::string ConversionContext::releaseAssetBuffer() noexcept
+{
+    return std::move(asset_buffer_);
+}
+
+MediaTypeTable& ConversionContext::mediaTypes() noexcept
+{
+    return media_types_;
+}
+
+ConversionBudget& ConversionContext::budget() noexcept
+{
+    return *budget_;
+}
+
+ParseProgress* ConversionContext::progress() const noexcept
+{
+    return progress_;
+}
+
+void ConversionContext::progress(ParseProgress* value) noexcept
+{
+    progress_ = value;
+}
+
 void ConversionContext::warn(const snowcrash::Warning& warning)
 {
     for (auto& item : warnings_) {
@@ -9,8 +9,11 @@
 #define DRAFTER_CONVERSIONCONTEXT_H
 
 #include <boost/container/vector.hpp>
+#include <string>
 
 #include "refract/Registry.h"
+#include "ConversionBudget.h"
+#include "MediaTypeTable.h"
 #include "SourceMapUtils.h"
 #include "options.h"
 
@@ -21,33 +24,91 @@ namespace snowcrash
 
 namespace drafter
 {
+    class ParseProgress;
+
     class ConversionContext
     {
     public:
         using Warnings = boost::container::vector<snowcrash::SourceAnnotation>;
 
     private:
-        const NewLinesIndex newline_indices_;
+        const char* const source_;
+        mutable NewLinesIndex newline_indices_;
+        mutable bool newline_indices_built_ = false;
+        const ConversionContext* newline_indices_owner_ = this;
         const bool expand_mson_;
         const drafter_parse_options* const options_;
+        bool annotations_only_ = false;
 
         refract::Registry registry_;
+        refract::Registry* types_;
         Warnings warnings_;
 
+        ConversionBudget own_budget_;
+        ConversionBudget* budget_;
+        ParseProgress* progress_ = nullptr;
+
+        std::string asset_buffer_;
+        MediaTypeTable media_types_;
+
     public:
+        /// The source must outlive the context
         explicit ConversionContext( //
             const char*,
             const drafter_parse_options* opts = nullptr,
             bool expandMson = false // TODO avoid, only used in unit tests
             ) noexcept;
 
-        const NewLinesIndex& newlineIndices() const noexcept;
+        /// Reuse the scratch buffer released by a previous conversion;
+        /// the time limit counts from given start of parsing
+        ConversionContext(const char*,
+            const drafter_parse_options* opts,
+            std::string assetBuffer,
+            ConversionBudget::clock::time_point start) noexcept;
+
+        struct SharedTypes {
+        };
+
+        /// Context converting a part of the document on another thread;
+        /// it shares the type registry of the parent, which must not be
+        /// modified until the part is converted, its budget, progress and
+        /// line end positions, which must be built before the part is
+        /// converted
+        ConversionContext(ConversionContext& parent, SharedTypes) noexcept;
+
+        ConversionContext(const ConversionContext&) = delete;
+        ConversionContext& operator=(const ConversionContext&) = delete;
+
+        /// Line end positions of the source, built on first use by the
+        ///     context owning them
+        const NewLinesIndex& newlineIndices() const;
 
         bool expandMson() const noexcept;
 
+        /// Whether only annotations are of interest; conversion may then
+        /// skip whatever cannot raise an error or a warning
+        bool annotationsOnly() const noexcept;
+        void annotationsOnly(bool) noexcept;
+
         refract::Registry& typeRegistry() noexcept;
         const refract::Registry& typeRegistry() const noexcept;
 
+        /// Scratch buffer reused to render generated assets
+        std::string& assetBuffer() noexcept;
+
+        /// Hand the scratch buffer over to a later conversion
+        std::string releaseAssetBuffer() noexcept;
+
+        /// Media types of the Content-Type values seen so far
+        MediaTypeTable& mediaTypes() noexcept;
+
+        /// Limits on the work of the conversion
+        ConversionBudget& budget() noexcept;
+
+        /// Progress of the parse, nullptr unless it is to be polled
+        ParseProgress* progress() const noexcept;
+        void progress(ParseProgress*) noexcept;
+
         const Warnings& warnings() const noexcept;
         void warn(const snowcrash::Warning& warning);
 
@@ -0,0 +1,29 @@
+//
+//  MediaTypeTable.cc
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "MediaTypeTable.h"
+
+#include <apib/parser/MediaTypeParser.h>
+
+#include "backend/MediaTypeS11n.h"
+
+using namespace drafter;
+
+const InternedMediaType& MediaTypeTable::intern(const std::string& contentType)
+{
+    auto it = entries_.find(contentType);
+
+    if (it == entries_.end()) {
+        InternedMediaType entry;
+        entry.value = apib::parser::parseMediaType(contentType);
+        entry.serialized = apib::backend::serialize(entry.value);
+
+        it = entries_.emplace(contentType, std::move(entry)).first;
+    }
+
+    return it->second;
+}
@@ -0,0 +1,55 @@
+//
+//  MediaTypeTable.h
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef DRAFTER_MEDIATYPETABLE_H
+#define DRAFTER_MEDIATYPETABLE_H
+
+#include <string>
+#include <unordered_map>
+
+#include <apib/syntax/MediaType.h>
+
+namespace drafter
+{
+    ///
+    /// Media type parsed from a Content-Type header value, and its
+    /// serialization
+    ///
+    struct InternedMediaType {
+        apib::syntax::media_type value;
+        std::string serialized;
+    };
+
+    ///
+    /// Media types of a document, parsed and serialized once per distinct
+    /// Content-Type header value
+    ///
+    /// Documents tend to repeat a handful of Content-Type values over all
+    /// their payloads.
+    ///
+    class MediaTypeTable
+    {
+        std::unordered_map<std::string, InternedMediaType> entries_;
+
+    public:
+        MediaTypeTable() = default;
+
+        MediaTypeTable(const MediaTypeTable&) = delete;
+        MediaTypeTable& operator=(const MediaTypeTable&) = delete;
+
+        /// Media type of a Content-Type header value; the reference stays
+        /// valid as long as the table
+        const InternedMediaType& intern(const std::string& contentType);
+
+        std::size_t size() const noexcept
+        {
+            return entries_.size();
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,288 @@
+//
+//  ParseCache.cc
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+#include "ParseCache.h"
+
+#include "options.h"
+#include "utils/Sha256.h"
+
+#include <algorithm>
+#include <atomic>
+#include <ctime>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <utime.h>
+#define DRAFTER_PARSE_CACHE_ENABLED 1
+#endif
+
+using namespace drafter;
+
+namespace
+{
+    const char EntryMagic[] = "drafter-parse-cache 1";
+    const char EntrySuffix[] = ".entry";
+    const char TmpSuffix[] = ".tmp";
+
+    // a temporary file this old was left behind by a writer that died
+    constexpr std::time_t StaleTmpAge = 60 * 60;
+
+    // stores between scans of a directory not known to be over its limit;
+    // other processes may fill it meanwhile
+    constexpr unsigned ScanInterval = 64;
+
+    // what this process knows about the size of a cache directory
+    struct DirectoryUsage {
+        bool scanned = false;    //< total is known
+        std::uintmax_t total = 0; //< bytes at the last scan plus those stored since
+        unsigned stores = 0;     //< stores since the last scan
+    };
+
+    std::mutex usageMutex;
+    std::map<std::string, DirectoryUsage> usage;
+
+    // account for a store to a directory; true if it should be scanned
+    bool stored(const std::string& dir, std::uintmax_t size, std::uintmax_t maxSize)
+    {
+        std::lock_guard<std::mutex> lock(usageMutex);
+        auto& u = usage[dir];
+
+        u.total += size;
+        return !u.scanned || u.total > maxSize || ++u.stores >= ScanInterval;
+    }
+
+    void scanned(const std::string& dir, std::uintmax_t total)
+    {
+        std::lock_guard<std::mutex> lock(usageMutex);
+        auto& u = usage[dir];
+
+        u.scanned = true;
+        u.total = total;
+        u.stores = 0;
+    }
+
+    bool endsWith(const std::string& s, const char* suffix)
+    {
+        const std::size_t n = std::char_traits<char>::length(suffix);
+        return s.size() >= n && s.compare(s.size() - n, n, suffix) == 0;
+    }
+} // namespace
+
+constexpr std::uintmax_t ParseCache::DefaultMaxSize;
+
+ParseCache::ParseCache(std::string dir, std::uintmax_t maxSize) : dir_(std::move(dir)), maxSize_(maxSize) {}
+
+std::string ParseCache::key(const char* source,
+    std::size_t size,
+    const drafter_parse_options* parseOpts,
+    const drafter_serialize_options* serializeOpts,
+    const std::string& salt)
+{
+    std::string options;
+    options += drafter_version_string();
+    options += '|';
+    options += parseOpts ? parseOpts->flags.to_string() : drafter_parse_options::flags_type{}.to_string();
+    options += '|';
+
+    // the time limit is left out, results it stops are not stored
+    const parse_limits limits = get_limits(parseOpts);
+    options += std::to_string(limits.expansion_depth);
+    options += ',';
+    options += std::to_string(limits.expanded_elements);
+    options += ',';
+    options += std::to_string(limits.asset_size);
+    options += '|';
+    options += are_sourcemaps_included(serializeOpts) ? 's' : '-';
+    options += static_cast<char>('0' + get_format(serializeOpts));
+    options += '|';
+    options += salt;
+
+    // the options are prefixed with their length, so no source can pass
+    // for a part of them
+    const std::string prefix = std::to_string(options.size()) + ':';
+
+    utils::Sha256 digest;
+    digest.update(prefix.data(), prefix.size());
+    digest.update(options.data(), options.size());
+    digest.update(source, size);
+
+    const std::string result = utils::to_hex(digest.finish());
+    return result;
+}
+
+std::string ParseCache::path(const std::string& key) const
+{
+    return dir_ + "/" + key + EntrySuffix;
+}
+
+bool ParseCache::load(const std::string& key, Entry& entry) const
+{
+#if defined(DRAFTER_PARSE_CACHE_ENABLED)
+    const std::string file = path(key);
+
+    std::ifstream in(file, std::ios::binary);
+    if (!in)
+        return false;
+
+    std::string magic;
+    std::size_t outputSize = 0;
+    std::size_t reportSize = 0;
+    int code = 0;
+
+    if (!std::getline(in, magic) || magic != EntryMagic)
+        return false;
+
+    if (!(in >> code >> outputSize >> reportSize) || in.get() != '\n')
+        return false;
+
+    // the sizes must account for the rest of the file, or it is no entry
+    // to allocate for
+    const std::streampos body = in.tellg();
+    if (body < 0 || !in.seekg(0, std::ios::end))
+        return false;
+
+    const std::uintmax_t remaining = static_cast<std::uintmax_t>(in.tellg() - body);
+    if (outputSize > remaining || reportSize != remaining - outputSize) {
+        in.close();
+        std::remove(file.c_str());
+        return false;
+    }
+
+    in.seekg(body);
+
+    Entry result;
+    result.code = code;
+    result.output.resize(outputSize);
+    result.report.resize(reportSize);
+
+    if (!in.read(&result.output[0], outputSize) || !in.read(&result.report[0], reportSize))
+        return false;
+
+    // mark as recently used for eviction
+    ::utime(file.c_str(), nullptr);
+
+    entry = std::move(result);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void ParseCache::store(const std::string& key, const Entry& entry) const
+{
+#if defined(DRAFTER_PARSE_CACHE_ENABLED)
+    static std::atomic<unsigned> counter{ 0 };
+
+    ::mkdir(dir_.c_str(), 0777);
+
+    std::ostringstream tmpName;
+    tmpName << dir_ << "/" << key << "." << ::getpid() << "." << counter++ << TmpSuffix;
+    const std::string tmp = tmpName.str();
+
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        if (!out)
+            return;
+
+        out << EntryMagic << '\n' << entry.code << ' ' << entry.output.size() << ' ' << entry.report.size() << '\n';
+        out.write(entry.output.data(), entry.output.size());
+        out.write(entry.report.data(), entry.report.size());
+
+        if (!out.flush()) {
+            out.close();
+            std::remove(tmp.c_str());
+            return;
+        }
+    }
+
+    // atomically replaces any entry written concurrently for the same key
+    if (std::rename(tmp.c_str(), path(key).c_str()) != 0) {
+        std::remove(tmp.c_str());
+        return;
+    }
+
+    if (stored(dir_, entry.output.size() + entry.report.size(), maxSize_))
+        scanned(dir_, evict(key));
+#endif
+}
+
+std::uintmax_t ParseCache::evict(const std::string& keep) const
+{
+#if defined(DRAFTER_PARSE_CACHE_ENABLED)
+    struct Candidate {
+        std::string file;
+        std::time_t used;
+        std::uintmax_t size;
+    };
+
+    DIR* dir = ::opendir(dir_.c_str());
+    if (!dir)
+        return 0;
+
+    const std::string kept = keep + EntrySuffix;
+
+    const std::time_t staleBefore = std::time(nullptr) - StaleTmpAge;
+
+    std::vector<Candidate> entries;
+    std::uintmax_t total = 0;
+
+    while (const dirent* d = ::readdir(dir)) {
+        const std::string name = d->d_name;
+        const bool tmp = endsWith(name, TmpSuffix);
+        if (!tmp && !endsWith(name, EntrySuffix))
+            continue;
+
+        const std::string file = dir_ + "/" + name;
+        struct stat st;
+        if (::stat(file.c_str(), &st) != 0)
+            continue;
+
+        if (tmp && st.st_mtime < staleBefore && std::remove(file.c_str()) == 0)
+            continue;
+
+        total += st.st_size;
+
+        // temporary files in use are counted, but only their writer removes them
+        if (tmp)
+            continue;
+
+        // the entry just stored is the most recently used one
+        if (name != kept)
+            entries.push_back({ file, st.st_mtime, static_cast<std::uintmax_t>(st.st_size) });
+    }
+
+    ::closedir(dir);
+
+    if (total <= maxSize_)
+        return total;
+
+    std::sort(entries.begin(), entries.end(), [](const Candidate& lhs, const Candidate& rhs) { //
+        return lhs.used < rhs.used;
+    });
+
+    // other processes may evict concurrently; a missing file is not an error
+    for (const auto& candidate : entries) {
+        if (total <= maxSize_)
+            break;
+
+        std::remove(candidate.file.c_str());
+        total -= candidate.size;
+    }
+
+    return total;
+#else
+    return 0;
+#endif
+}
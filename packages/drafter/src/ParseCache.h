@@ -0,0 +1,90 @@
+//
+//  ParseCache.h
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+#ifndef DRAFTER_PARSECACHE_H
+#define DRAFTER_PARSECACHE_H
+
+#include <cstdint>
+#include <string>
+
+#include "drafter.h"
+
+namespace drafter
+{
+    ///
+    /// Content addressed, size bounded store of parse results in a local
+    ///     directory
+    ///
+    /// Entries are written to a temporary file and renamed into place, so
+    /// any number of processes may share the directory; readers either see
+    /// a complete entry or none. When the total size of entries exceeds the
+    /// limit, least recently used entries are removed. Temporary files count
+    /// towards the limit; those left behind by dead writers are removed by
+    /// age.
+    ///
+    /// The directory is scanned on the first store of a process, whenever
+    /// the size it tracks since exceeds the limit and every 64 stores.
+    ///
+    /// @remark the store is disabled on platforms without POSIX file APIs
+    ///
+    class ParseCache
+    {
+    public:
+        static constexpr std::uintmax_t DefaultMaxSize = 64 * 1024 * 1024;
+
+        struct Entry {
+            int code = 0;       //< drafter_error returned by the parse
+            std::string output; //< serialized Parse Result
+            std::string report; //< annotations as reported by the CLI
+        };
+
+    private:
+        const std::string dir_;
+        const std::uintmax_t maxSize_;
+
+        std::string path(const std::string& key) const;
+        std::uintmax_t evict(const std::string& keep) const;
+
+    public:
+        ParseCache(std::string dir, std::uintmax_t maxSize = DefaultMaxSize);
+
+        ///
+        /// Compute the cache key of a parse
+        ///
+        /// @param source       API Blueprint
+        /// @param size         length of source in bytes
+        /// @param parseOpts    parse options or nullptr
+        /// @param serializeOpts serialisation options or nullptr
+        /// @param salt         distinguishes entries of different consumers
+        ///
+        /// @return SHA-256 of source, options and drafter version, in hex
+        ///
+        static std::string key(const char* source,
+            std::size_t size,
+            const drafter_parse_options* parseOpts,
+            const drafter_serialize_options* serializeOpts,
+            const std::string& salt = {});
+
+        ///
+        /// Look up an entry
+        ///
+        /// @param key      key as computed by ParseCache::key
+        /// @param entry    receives the stored entry on hit
+        ///
+        /// @return true on hit
+        ///
+        bool load(const std::string& key, Entry& entry) const;
+
+        ///
+        /// Store an entry, evicting old ones if the size limit is exceeded
+        ///
+        /// @remark failures are silently ignored; the cache is best effort
+        ///
+        void store(const std::string& key, const Entry& entry) const;
+    };
+} // namespace drafter
+
+#endif
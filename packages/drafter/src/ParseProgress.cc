@@ -0,0 +1,73 @@
+//
+//  ParseProgress.cc
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "ParseProgress.h"
+
+#include "SourceAnnotation.h"
+
+using namespace drafter;
+
+ParseProgress::ParseProgress(const drafter_parse_options* opts, std::size_t total) noexcept
+    : token_(get_cancel_token(opts)), callback_(get_progress(opts)), ctx_(get_progress_ctx(opts)), total_(total)
+{
+}
+
+bool ParseProgress::active() const noexcept
+{
+    return token_ || callback_;
+}
+
+bool ParseProgress::cancelled() const noexcept
+{
+    return cancelled_.load(std::memory_order_relaxed)
+        || (token_ && token_->cancelled.load(std::memory_order_relaxed));
+}
+
+bool ParseProgress::advance(drafter_progress_stage stage, std::size_t done) noexcept
+{
+    if (cancelled()) {
+        cancelled_.store(true, std::memory_order_relaxed);
+        return false;
+    }
+
+    if (!callback_) {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // sections parsed or converted concurrently are reached out of order
+    if (stage != stage_) {
+        stage_ = stage;
+        done_ = 0;
+    }
+
+    if (done > done_) {
+        done_ = done < total_ ? done : total_;
+    }
+
+    if (callback_(ctx_, stage_, done_, total_) != 0) {
+        cancelled_.store(true, std::memory_order_relaxed);
+        return false;
+    }
+
+    return true;
+}
+
+void ParseProgress::checkpoint(drafter_progress_stage stage, std::size_t done)
+{
+    if (!advance(stage, done)) {
+        throw snowcrash::Error("parsing cancelled", snowcrash::CancellationError);
+    }
+}
+
+void ParseProgress::checkpoint() const
+{
+    if (cancelled()) {
+        throw snowcrash::Error("parsing cancelled", snowcrash::CancellationError);
+    }
+}
@@ -0,0 +1,64 @@
+//
+//  ParseProgress.h
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef DRAFTER_PARSEPROGRESS_H
+#define DRAFTER_PARSEPROGRESS_H
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+#include "options.h"
+
+namespace drafter
+{
+    ///
+    /// Progress of a parse and its cancellation, see drafter_set_progress
+    /// and drafter_set_cancel_token
+    ///
+    /// Polled by the threads parsing and converting a document, which call
+    /// the progress callback one at a time. Once cancelled, by the token or
+    /// by the callback, the parse stays cancelled.
+    ///
+    class ParseProgress
+    {
+        const drafter_cancel_token* const token_;
+        const drafter_progress_fn callback_;
+        void* const ctx_;
+        const std::size_t total_;
+
+        std::atomic<bool> cancelled_{ false };
+
+        std::mutex mutex_;
+        drafter_progress_stage stage_ = DRAFTER_PROGRESS_PARSING;
+        std::size_t done_ = 0;
+
+    public:
+        ParseProgress(const drafter_parse_options*, std::size_t total) noexcept;
+
+        ParseProgress(const ParseProgress&) = delete;
+        ParseProgress& operator=(const ParseProgress&) = delete;
+
+        /// Whether there is a token or a callback to poll
+        bool active() const noexcept;
+
+        bool cancelled() const noexcept;
+
+        /// Report the stage reached given byte of the source; the reported
+        /// position never goes back within a stage
+        ///
+        /// @return false if the parse is cancelled
+        bool advance(drafter_progress_stage, std::size_t done) noexcept;
+
+        /// Throw snowcrash::Error of snowcrash::CancellationError code if
+        /// the parse is cancelled
+        void checkpoint(drafter_progress_stage, std::size_t done);
+        void checkpoint() const;
+    };
+}
+
+#endif
@@ -13,7 +13,9 @@
 #include "Render.h"
 #include "RefractSourceMap.h"
 
+#include "refract/ElementTraits.h"
 #include "refract/Exception.h"
+#include "refract/GenerationContext.h"
 #include "refract/JsonValue.h"
 #include "refract/JsonSchema.h"
 
@@ -21,16 +23,22 @@
 #include "utils/so/JsonIo.h"
 
 #include <apib/syntax/MediaType.h>
-#include <apib/parser/MediaTypeParser.h>
 
 #include "backend/MediaTypeS11n.h"
-#include "backend/Backend.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <exception>
 #include <iterator>
 #include <set>
+#include <system_error>
+#include <thread>
+#include <vector>
 
 #include "NamedTypesRegistry.h"
 #include "ConversionContext.h"
+#include "ParseProgress.h"
 
 using namespace drafter;
 using namespace refract;
@@ -103,6 +111,16 @@ namespace
     {
         return !action.isNull() && !action.node->method.empty();
     }
+
+    /// Report the conversion reached given node, throws if the parse is cancelled
+    template <typename T>
+    void Checkpoint(const NodeInfo<T>& node, ConversionContext& context)
+    {
+        if (ParseProgress* progress = context.progress()) {
+            const auto& sourceMap = node.sourceMap->sourceMap;
+            progress->checkpoint(DRAFTER_PROGRESS_CONVERTING, sourceMap.empty() ? 0 : sourceMap.front().location);
+        }
+    }
 } // namespace
 
 std::unique_ptr<IElement> drafter::DataStructureToRefract(
@@ -281,48 +299,151 @@ namespace
         return media_type{ "text", "plain", "", {} };
     }
 
+    const std::string& serializedJsonSchemaType()
+    {
+        static const std::string serialized = apib::backend::serialize(jsonSchemaType());
+        return serialized;
+    }
+
+    const std::string& serializedTextPlainType()
+    {
+        static const std::string serialized = apib::backend::serialize(textPlainType());
+        return serialized;
+    }
+
     void generateValueAsset( //
         ArrayElement::ValueType& out,
-        const ConversionContext& context,
+        ConversionContext& context,
         const IElement& expanded,
-        const media_type& mediaType)
+        refract::ElementTraitsCache& traits,
+        const InternedMediaType& mediaType)
     {
-        using apib::backend::serialize;
-        if (apib::isJSON(mediaType)) {
-            std::stringstream ss{};
-            drafter::utils::so::serialize_json(ss, refract::generateJsonValue(expanded));
-            out.push_back(make_asset_element(ss.str(), SerializeKey::MessageBody, serialize(mediaType)));
+        if (apib::isJSON(mediaType.value)) {
+            const auto limits = context.budget().generationLimits();
+            refract::GenerationContext generation(traits, limits);
+
+            auto& buffer = context.assetBuffer();
+            buffer.clear();
+            drafter::utils::so::serialize_json(buffer, refract::generateJsonValue(expanded, generation));
+            context.budget().generated(buffer.size());
+
+            if (!context.annotationsOnly())
+                out.push_back(make_asset_element(buffer, SerializeKey::MessageBody, mediaType.serialized));
         }
     }
 
     void generateSchemaAsset( //
         ArrayElement::ValueType& out,
-        const ConversionContext& context,
+        ConversionContext& context,
         const IElement& expanded,
-        const media_type& mediaType)
+        refract::ElementTraitsCache& traits,
+        const InternedMediaType& mediaType)
     {
-        using apib::backend::serialize;
-        if (apib::isJSON(mediaType)) {
-            std::stringstream ss{};
-            drafter::utils::so::serialize_json(ss, refract::schema::generateJsonSchema(expanded));
-            out.push_back(make_asset_element(ss.str(), SerializeKey::MessageBodySchema, serialize(jsonSchemaType())));
+        if (apib::isJSON(mediaType.value)) {
+            const auto limits = context.budget().generationLimits();
+            refract::GenerationContext generation(traits, limits);
+
+            auto& buffer = context.assetBuffer();
+            buffer.clear();
+            drafter::utils::so::serialize_json(buffer, refract::schema::generateJsonSchema(expanded, generation));
+            context.budget().generated(buffer.size());
+
+            if (!context.annotationsOnly())
+                out.push_back(make_asset_element(buffer, SerializeKey::MessageBodySchema, serializedJsonSchemaType()));
         }
     }
 
+    ///
+    /// Assets to generate from the attributes of a payload lacking them
+    ///
+    struct GeneratedAssets {
+        bool body;
+        bool schema;
+    };
+
+    GeneratedAssets generatedAssets(const snowcrash::Payload& payload,
+        bool request,
+        const snowcrash::HTTPMethod& method,
+        const InternedMediaType& mediaType,
+        const drafter_parse_options* options)
+    {
+        GeneratedAssets result{ payload.body.empty() && !is_skip_gen_bodies(options),
+            payload.schema.empty() && !is_skip_gen_body_schemas(options) };
+
+        if (drafter_gen_policy_fn policy = get_gen_policy(options)) {
+            void* ctx = get_gen_policy_ctx(options);
+            const unsigned status = request ? 0 : static_cast<unsigned>(std::strtoul(payload.name.c_str(), nullptr, 10));
+
+            result.body = result.body
+                && policy(ctx, DRAFTER_GEN_BODY, method.c_str(), status, mediaType.serialized.c_str()) != 0;
+            result.schema = result.schema
+                && policy(ctx, DRAFTER_GEN_BODY_SCHEMA, method.c_str(), status, mediaType.serialized.c_str()) != 0;
+        }
+
+        return result;
+    }
+
     void attachDataStructure(std::unique_ptr<IElement> ds, ArrayElement::ValueType& out)
     {
         out.push_back(refract::make_unique<HolderElement>(SerializeKey::DataStructure, dsd::Holder(std::move(ds))));
     }
 
+    ///
+    /// Action attributes, converted and expanded on first use
+    ///
+    /// Shared by all request payloads of an action lacking attributes of
+    /// their own, so the conversion is done once per action.
+    ///
+    class ActionDataStructure
+    {
+        const NodeInfo<snowcrash::Action>& action_;
+        ConversionContext& context_;
+
+        bool converted_ = false;
+        std::unique_ptr<IElement> expanded_;
+        refract::ElementTraitsCache traits_;
+
+    public:
+        ActionDataStructure(const NodeInfo<snowcrash::Action>& action, ConversionContext& context)
+            : action_(action), context_(context), expanded_(), traits_()
+        {
+        }
+
+        bool empty() const noexcept
+        {
+            return action_.isNull() || action_.node->attributes.empty();
+        }
+
+        const IElement* get()
+        {
+            if (!converted_) {
+                converted_ = true;
+                if (!action_.isNull() && !action_.node->attributes.empty())
+                    expanded_ = ExpandRefract(MSONToRefract(MAKE_NODE_INFO(action_, attributes), context_), context_);
+            }
+            return expanded_.get();
+        }
+
+        refract::ElementTraitsCache& traits() noexcept
+        {
+            return traits_;
+        }
+    };
+
 }
 
 std::unique_ptr<IElement> PayloadToRefract( //
     const NodeInfo<snowcrash::Payload>& payload,
     const NodeInfo<snowcrash::Action>& action,
+    ActionDataStructure* actionDataStructure,
+    const snowcrash::HTTPMethod& method,
     ConversionContext& context)
 {
     using namespace snowcrash;
-    using apib::backend::serialize;
+
+    // payloads are where the time goes, expanding and generating assets
+    context.budget().checkTime();
+    Checkpoint(payload, context);
 
     auto result = make_element<ArrayElement>();
 
@@ -377,32 +498,52 @@ std::unique_ptr<IElement> PayloadToRefract( //
             if (auto expanded = ExpandRefract(clone(*dataStructure), context)) {
                 attachDataStructure(std::move(expanded), content);
             }
-        } else {
+        } else if (!context.annotationsOnly()) {
             attachDataStructure(clone(*dataStructure), content);
         }
     }
 
-    // Get content type
-    const auto mediaType = apib::parser::parseMediaType( //
-        getContentTypeFromHeaders(payload.node->headers) //
-    );
+    // Get content type, parsed once per distinct value in the document
+    const auto& mediaType = context.mediaTypes().intern(getContentTypeFromHeaders(payload.node->headers));
+
+    const bool hasAttributes = dataStructure || (actionDataStructure && !actionDataStructure->empty());
+
+    const GeneratedAssets generated = hasAttributes ? //
+        generatedAssets(*payload.node, isRequest(action), method, mediaType, context.options()) :
+        GeneratedAssets{ false, false };
+
+    // Determine any MSON to generate value/schema; expansion errors are
+    // annotations, so it is done even if the assets are not generated,
+    // unless a generation policy declines them
+    const bool expand = !get_gen_policy(context.options()) || generated.body || generated.schema;
+
+    auto ownExpanded = (dataStructure && expand) ? ExpandRefract(std::move(dataStructure), context) : nullptr;
+
+    // Analysis of the expanded tree shared by body and schema generation
+    refract::ElementTraitsCache ownTraits;
+
+    const IElement* dataStructureExpanded = ownExpanded.get();
+    refract::ElementTraitsCache* traits = &ownTraits;
+
+    if (!dataStructureExpanded && actionDataStructure && expand) {
+        dataStructureExpanded = actionDataStructure->get();
+        traits = &actionDataStructure->traits();
+    }
 
-    // Determine any MSON to generate value/schema
-    if (!dataStructure && !action.isNull() && !action.node->attributes.empty())
-        dataStructure = MSONToRefract(MAKE_NODE_INFO(action, attributes), context);
-    auto dataStructureExpanded = dataStructure ? ExpandRefract(std::move(dataStructure), context) : nullptr;
+    // Assets are generated in check mode only to report the limits they exceed
+    const bool generate = !context.annotationsOnly() || context.budget().boundsGeneration();
 
     // Push Body Asset
     if (!payload.node->body.empty()) {
         content.push_back(make_asset_element( //
             payload.node->body,
             SerializeKey::MessageBody,
-            serialize(mediaType),
+            mediaType.serialized,
             &payload.sourceMap->body.sourceMap));
 
-    } else if (dataStructureExpanded && !is_skip_gen_bodies(context.options())) {
+    } else if (dataStructureExpanded && generate && generated.body) {
         // otherwise, generate one from attributes
-        generateValueAsset(content, context, *dataStructureExpanded, mediaType);
+        generateValueAsset(content, context, *dataStructureExpanded, *traits, mediaType);
     }
 
     // Push Schema Asset
@@ -410,12 +551,12 @@ std::unique_ptr<IElement> PayloadToRefract( //
         content.push_back(make_asset_element( //
             payload.node->schema,
             SerializeKey::MessageBodySchema,
-            serialize(apib::isJSON(mediaType) ? jsonSchemaType() : textPlainType()),
+            apib::isJSON(mediaType.value) ? serializedJsonSchemaType() : serializedTextPlainType(),
             &payload.sourceMap->schema.sourceMap));
 
-    } else if (dataStructureExpanded && !is_skip_gen_body_schemas(context.options())) {
+    } else if (dataStructureExpanded && generate && generated.schema) {
         // otherwise, generate one from attributes
-        generateSchemaAsset(content, context, *dataStructureExpanded, mediaType);
+        generateSchemaAsset(content, context, *dataStructureExpanded, *traits, mediaType);
     }
 
     return std::move(result);
@@ -423,6 +564,7 @@ std::unique_ptr<IElement> PayloadToRefract( //
 
 std::unique_ptr<ArrayElement> TransactionToRefract(const NodeInfo<snowcrash::TransactionExample>& transaction,
     const NodeInfo<snowcrash::Action>& action,
+    ActionDataStructure& actionDataStructure,
     const NodeInfo<snowcrash::Request>& request,
     const NodeInfo<snowcrash::Response>& response,
     ConversionContext& context)
@@ -434,8 +576,9 @@ std::unique_ptr<ArrayElement> TransactionToRefract(const NodeInfo<snowcrash::Tra
 
     if (!transaction.node->description.empty())
         content.push_back(CopyToRefract(MAKE_NODE_INFO(transaction, description)));
-    content.push_back(PayloadToRefract(request, action, context));
-    content.push_back(PayloadToRefract(response, NodeInfo<snowcrash::Action>(), context));
+    content.push_back(PayloadToRefract(request, action, &actionDataStructure, action.node->method, context));
+    content.push_back(
+        PayloadToRefract(response, NodeInfo<snowcrash::Action>(), nullptr, action.node->method, context));
 
     RemoveEmptyElements(content);
 
@@ -475,6 +618,8 @@ std::unique_ptr<ArrayElement> ActionToRefract(const NodeInfo<snowcrash::Action>&
     if (!action.node->description.empty())
         content.push_back(CopyToRefract(MAKE_NODE_INFO(action, description)));
 
+    ActionDataStructure actionDataStructure(action, context);
+
     typedef NodeInfoCollection<snowcrash::TransactionExamples> ExamplesType;
     ExamplesType examples(MAKE_NODE_INFO(action, examples));
 
@@ -487,8 +632,8 @@ std::unique_ptr<ArrayElement> ActionToRefract(const NodeInfo<snowcrash::Action>&
             ResponsesType responses(example.node->responses, example.sourceMap->responses);
 
             for (const auto& response : responses) {
-                content.push_back(
-                    TransactionToRefract(example, action, NodeInfo<snowcrash::Request>(), response, context));
+                content.push_back(TransactionToRefract(
+                    example, action, actionDataStructure, NodeInfo<snowcrash::Request>(), response, context));
             }
         }
 
@@ -499,15 +644,16 @@ std::unique_ptr<ArrayElement> ActionToRefract(const NodeInfo<snowcrash::Action>&
         for (const auto& request : requests) {
 
             if (example.node->responses.empty()) {
-                content.push_back(
-                    TransactionToRefract(example, action, request, NodeInfo<snowcrash::Response>(), context));
+                content.push_back(TransactionToRefract(
+                    example, action, actionDataStructure, request, NodeInfo<snowcrash::Response>(), context));
             }
 
             typedef NodeInfoCollection<snowcrash::Responses> ResponsesType;
             ResponsesType responses(example.node->responses, example.sourceMap->responses);
 
             for (const auto& response : responses) {
-                content.push_back(TransactionToRefract(example, action, request, response, context));
+                content.push_back(
+                    TransactionToRefract(example, action, actionDataStructure, request, response, context));
             }
         }
     }
@@ -520,6 +666,8 @@ std::unique_ptr<ArrayElement> ActionToRefract(const NodeInfo<snowcrash::Action>&
 std::unique_ptr<ArrayElement> ResourceToRefract(
     const NodeInfo<snowcrash::Resource>& resource, ConversionContext& context)
 {
+    Checkpoint(resource, context);
+
     auto element = make_element<ArrayElement>();
 
     element->element(SerializeKey::Resource);
@@ -556,6 +704,8 @@ const snowcrash::SourceMap<snowcrash::Elements>* GetElementChildrenSourceMap(
 
 std::unique_ptr<ArrayElement> CategoryToRefract(const NodeInfo<snowcrash::Element>& element, ConversionContext& context)
 {
+    Checkpoint(element, context);
+
     auto category = make_element<ArrayElement>();
 
     category->element(SerializeKey::Category);
@@ -603,6 +753,80 @@ std::unique_ptr<IElement> ElementToRefract(const NodeInfo<snowcrash::Element>& e
     }
 }
 
+namespace
+{
+    ///
+    /// Conversion of a top-level element on a worker thread
+    ///
+    struct ElementConversion {
+        std::unique_ptr<IElement> result;
+        std::unique_ptr<ConversionContext> context;
+        std::exception_ptr error;
+    };
+
+    /// Convert top-level elements on up to given number of threads
+    ///
+    /// Named types are registered before, so elements depend on nothing
+    /// but the (then read-only) type registry. The results and the
+    /// warnings of each element are assembled in document order; a
+    /// conversion failure is rethrown as the sequential conversion would,
+    /// after the warnings of the elements preceding it.
+    void ConcurrentElementsToRefract(const NodeInfo<snowcrash::Elements>& elements,
+        ArrayElement::ValueType& content,
+        ConversionContext& context,
+        unsigned concurrency)
+    {
+        const NodeInfoCollection<snowcrash::Elements> collection(elements);
+        std::vector<ElementConversion> conversions(collection.size());
+        std::atomic<std::size_t> next{ 0 };
+
+        auto convert = [&]() {
+            for (std::size_t i = next++; i < conversions.size(); i = next++) {
+                auto& conversion = conversions[i];
+
+                try {
+                    conversion.context.reset(new ConversionContext(context, ConversionContext::SharedTypes{}));
+                    conversion.result = ElementToRefract(collection[i], *conversion.context);
+                } catch (...) {
+                    conversion.error = std::current_exception();
+                    next = conversions.size(); // later elements are discarded anyway
+                }
+            }
+        };
+
+        // line numbers are built once and shared, the workers could only
+        // race building them on first use
+        context.newlineIndices();
+
+        std::vector<std::thread> workers;
+        const std::size_t threads = std::min<std::size_t>(concurrency, conversions.size());
+
+        for (std::size_t i = 1; i < threads; ++i) {
+            try {
+                workers.emplace_back(convert);
+            } catch (const std::system_error&) {
+                break; // convert with the threads there are
+            }
+        }
+
+        convert();
+
+        for (auto& worker : workers)
+            worker.join();
+
+        for (auto& conversion : conversions) {
+            if (conversion.context)
+                for (const auto& warning : conversion.context->warnings())
+                    context.warn(warning);
+
+            if (conversion.error)
+                std::rethrow_exception(conversion.error);
+
+            content.push_back(std::move(conversion.result));
+        }
+    }
+} // namespace
+
 std::unique_ptr<IElement> drafter::BlueprintToRefract(
     const NodeInfo<snowcrash::Blueprint>& blueprint, ConversionContext& context)
 {
@@ -623,7 +847,13 @@ std::unique_ptr<IElement> drafter::BlueprintToRefract(
             CollectionToRefract<ArrayElement>(MAKE_NODE_INFO(blueprint, metadata), context, MetadataToRefract));
     }
 
-    NodeInfoToElements(MAKE_NODE_INFO(blueprint, content.elements()), ElementToRefract, content, context);
+    const unsigned concurrency = get_concurrency(context.options());
+
+    if (concurrency > 1 && blueprint.node->content.elements().size() > 1) {
+        ConcurrentElementsToRefract(MAKE_NODE_INFO(blueprint, content.elements()), content, context, concurrency);
+    } else {
+        NodeInfoToElements(MAKE_NODE_INFO(blueprint, content.elements()), ElementToRefract, content, context);
+    }
 
     RemoveEmptyElements(content);
 
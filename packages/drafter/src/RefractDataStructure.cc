@@ -19,6 +19,7 @@
 #include "NamedTypesRegistry.h"
 #include "RefractElementFactory.h"
 #include "ConversionContext.h"
+#include "ParseProgress.h"
 
 #include "ElementData.h"
 #include "refract/ElementUtils.h"
@@ -1051,7 +1052,7 @@ namespace
     {
         // we don't have references resolved;
         // named elements can't be validated
-        if (!isReserved(element.element()))
+        if (!element.reserved())
             return true;
 
         if (const StringElement* value = get<const StringElement>(findValue(element)))
@@ -1296,6 +1297,20 @@ namespace
 
         return std::move(element);
     }
+
+    /// Poll of an expansion checking for cancellation after the budget
+    struct CancellablePoll {
+        std::function<void()> poll;
+        const ParseProgress* progress;
+
+        void operator()() const
+        {
+            if (poll) {
+                poll();
+            }
+            progress->checkpoint();
+        }
+    };
 } // namespace
 
 std::unique_ptr<IElement> drafter::MSONToRefract(
@@ -1332,8 +1347,16 @@ std::unique_ptr<IElement> drafter::ExpandRefract(std::unique_ptr<IElement> eleme
         return nullptr;
     }
 
-    ExpandVisitor expander(context.typeRegistry());
+    auto limits = context.budget().expandLimits();
+
+    // a single expansion may take long enough to be worth cancelling
+    if (const ParseProgress* progress = context.progress()) {
+        limits.poll = CancellablePoll{ std::move(limits.poll), progress };
+    }
+
+    ExpandVisitor expander(context.typeRegistry(), std::move(limits));
     Visit(expander, *element);
+    context.budget().expanded(expander.visited());
 
     if (auto expanded = expander.get()) {
         return expanded;
@@ -37,55 +37,92 @@ namespace helper
     };
 }
 
-std::unique_ptr<IElement> drafter::WrapRefract(
-    snowcrash::ParseResult<snowcrash::Blueprint>& blueprint, ConversionContext& context)
+namespace
 {
-    // auto parseResult = make_empty<ArrayElement>();
-    auto parseResult = make_element<ArrayElement>(); // XXX @tjanc@ review
-    snowcrash::Error error;
-
-    std::unique_ptr<IElement> blueprintRefract = nullptr;
+    /// Convert the blueprint, turning conversion failures into its error
+    std::unique_ptr<IElement> ConvertBlueprint(
+        snowcrash::ParseResult<snowcrash::Blueprint>& blueprint, ConversionContext& context)
+    {
+        snowcrash::Error error;
+
+        std::unique_ptr<IElement> blueprintRefract = nullptr;
+
+        if (blueprint.report.error.code == snowcrash::Error::OK) {
+            try {
+                RegisterNamedTypes(
+                    MakeNodeInfo(blueprint.node.content.elements(), blueprint.sourceMap.content.elements()), context);
+                blueprintRefract = BlueprintToRefract(MakeNodeInfo(blueprint.node, blueprint.sourceMap), context);
+            } catch (std::exception& e) {
+                error = snowcrash::Error(e.what(), snowcrash::MSONError);
+            } catch (snowcrash::Error& e) {
+                error = e;
+            }
+
+            context.typeRegistry().clear();
+
+            if (error.code != snowcrash::Error::OK) {
+                blueprint.report.error = error;
+            }
+        }
 
-    parseResult->element(SerializeKey::ParseResult);
+        return blueprintRefract;
+    }
 
-    if (blueprint.report.error.code == snowcrash::Error::OK) {
-        try {
-            RegisterNamedTypes(
-                MakeNodeInfo(blueprint.node.content.elements(), blueprint.sourceMap.content.elements()), context);
-            blueprintRefract = BlueprintToRefract(MakeNodeInfo(blueprint.node, blueprint.sourceMap), context);
-        } catch (std::exception& e) {
-            error = snowcrash::Error(e.what(), snowcrash::MSONError);
-        } catch (snowcrash::Error& e) {
-            error = e;
+    /// Append the error and warnings of both parsing and conversion
+    void AppendAnnotations(ArrayElement::ValueType& out,
+        snowcrash::ParseResult<snowcrash::Blueprint>& blueprint,
+        ConversionContext& context)
+    {
+        if (blueprint.report.error.code != snowcrash::Error::OK) {
+            out.push_back(helper::AnnotationToRefract(SerializeKey::Error, context)(blueprint.report.error));
         }
 
-        context.typeRegistry().clear();
+        snowcrash::Warnings& warnings = blueprint.report.warnings;
 
-        if (error.code != snowcrash::Error::OK) {
-            blueprint.report.error = error;
+        if (!context.warnings().empty()) {
+            warnings.insert(warnings.end(), context.warnings().begin(), context.warnings().end());
         }
 
-        if (blueprintRefract) {
-            parseResult->get().push_back(std::move(blueprintRefract));
+        if (!warnings.empty()) {
+            std::transform(warnings.begin(),
+                warnings.end(),
+                std::back_inserter(out),
+                helper::AnnotationToRefract(SerializeKey::Warning, context));
         }
     }
+} // namespace
 
-    if (blueprint.report.error.code != snowcrash::Error::OK) {
-        parseResult->get().push_back(helper::AnnotationToRefract(SerializeKey::Error, context)(blueprint.report.error));
-    }
+std::unique_ptr<IElement> drafter::WrapRefract(
+    snowcrash::ParseResult<snowcrash::Blueprint>& blueprint, ConversionContext& context)
+{
+    // auto parseResult = make_empty<ArrayElement>();
+    auto parseResult = make_element<ArrayElement>(); // XXX @tjanc@ review
 
-    snowcrash::Warnings& warnings = blueprint.report.warnings;
+    parseResult->element(SerializeKey::ParseResult);
 
-    if (!context.warnings().empty()) {
-        warnings.insert(warnings.end(), context.warnings().begin(), context.warnings().end());
+    if (auto blueprintRefract = ConvertBlueprint(blueprint, context)) {
+        parseResult->get().push_back(std::move(blueprintRefract));
     }
 
-    if (!warnings.empty()) {
-        std::transform(warnings.begin(),
-            warnings.end(),
-            std::back_inserter(parseResult->get()),
-            helper::AnnotationToRefract(SerializeKey::Warning, context));
-    }
+    AppendAnnotations(parseResult->get(), blueprint, context);
 
     return std::move(parseResult);
 }
+
+std::unique_ptr<IElement> drafter::WrapAnnotations(
+    snowcrash::ParseResult<snowcrash::Blueprint>& blueprint, ConversionContext& context)
+{
+    context.annotationsOnly(true);
+    ConvertBlueprint(blueprint, context);
+
+    ArrayElement::ValueType annotations;
+    AppendAnnotations(annotations, blueprint, context);
+
+    if (annotations.empty()) {
+        return nullptr;
+    }
+
+    auto result = refract::make_unique<ArrayElement>(std::move(annotations));
+    result->element(SerializeKey::ParseResult);
+    return std::move(result);
+}
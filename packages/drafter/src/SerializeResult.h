@@ -29,6 +29,15 @@ namespace drafter
 
     std::unique_ptr<refract::IElement> WrapRefract(
         snowcrash::ParseResult<snowcrash::Blueprint>& blueprint, ConversionContext& context);
+
+    ///
+    /// Collect the annotations WrapRefract would produce, without building
+    /// the API Elements tree they are reported along with
+    ///
+    /// @return parse result holding just the annotations; nullptr if there are none
+    ///
+    std::unique_ptr<refract::IElement> WrapAnnotations(
+        snowcrash::ParseResult<snowcrash::Blueprint>& blueprint, ConversionContext& context);
 }
 
 #endif // #ifndef DRAFTER_SERIALIZERESULT_H
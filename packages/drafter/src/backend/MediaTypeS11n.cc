@@ -16,21 +16,23 @@ using namespace apib::backend;
 
 namespace
 {
-    std::ostream& s8_qtext(std::ostream& out, const std::string& v)
+    void s8_qtext(std::string& out, const std::string& v)
     {
         for (const auto& c : v)
-            if (c == '\\' || c == '"')
-                out << '\\' << c;
-            else if (c == '\r')
-                out << "\\r";
+            if (c == '\\' || c == '"') {
+                out += '\\';
+                out += c;
+            } else if (c == '\r')
+                out += "\\r";
             else
-                out << c;
-        return out;
+                out += c;
     }
 
-    std::ostream& s8_quoted_string(std::ostream& out, const std::string& v)
+    void s8_quoted_string(std::string& out, const std::string& v)
     {
-        return s8_qtext(out << '"', v) << '"';
+        out += '"';
+        s8_qtext(out, v);
+        out += '"';
     }
 
     bool is_tspecial(char c) noexcept
@@ -42,38 +44,50 @@ namespace
         return false;
     }
 
-    std::ostream& s8_value(std::ostream& out, const std::string& v)
+    void s8_value(std::string& out, const std::string& v)
     {
         using std::begin;
         using std::end;
 
         if (end(v) == std::find_if(begin(v), end(v), [](const char c) { //
                 return is_tspecial(c) || std::isspace(c) || std::iscntrl(c);
-            }))
-            return (out << v);
+            })) {
+            out += v;
+            return;
+        }
 
-        return s8_quoted_string(out, v);
+        s8_quoted_string(out, v);
     }
 }
 
 std::ostream& apib::backend::operator<<(std::ostream& out, const apib::syntax::media_type& obj)
 {
+    return out << serialize(obj);
+}
+
+std::string apib::backend::serialize(const apib::syntax::media_type& obj)
+{
+    std::string out;
+
     if (obj.type.empty() || obj.subtype.empty())
         return out;
 
-    out << obj.type << '/' << obj.subtype;
+    out += obj.type;
+    out += '/';
+    out += obj.subtype;
 
     if (!obj.suffix.empty()) {
-        out << '+' << obj.suffix;
+        out += '+';
+        out += obj.suffix;
     }
 
-    if (!obj.parameters.empty()) {
-        for (const auto& p : obj.parameters) {
-            const auto& key = std::get<0>(p);
-            if (!key.empty()) {
-                out << "; " << std::get<0>(p) << '=';
-                s8_value(out, std::get<1>(p));
-            }
+    for (const auto& p : obj.parameters) {
+        const auto& key = std::get<0>(p);
+        if (!key.empty()) {
+            out += "; ";
+            out += key;
+            out += '=';
+            s8_value(out, std::get<1>(p));
         }
     }
 
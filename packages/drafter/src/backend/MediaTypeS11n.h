@@ -10,6 +10,7 @@
 #define APIB_BACKEND_MEDIA_TYPE_H
 
 #include <ostream>
+#include <string>
 
 namespace apib
 {
@@ -23,6 +24,9 @@ namespace apib
     namespace backend
     {
         std::ostream& operator<<(std::ostream&, const apib::syntax::media_type&);
+
+        // preferred over the generic serialize() of Backend.h, avoids a stream
+        std::string serialize(const apib::syntax::media_type&);
     }
 }
 #endif
@@ -25,6 +25,7 @@ namespace config
     static const std::string Version = "version";
     static const std::string UseLineNumbers = "use-line-num";
     static const std::string EnableLog = "enable-log";
+    static const std::string Cache = "cache";
 };
 
 void PrepareCommanLineParser(cmdline::parser& parser)
@@ -45,6 +46,7 @@ void PrepareCommanLineParser(cmdline::parser& parser)
     parser.add(
         config::UseLineNumbers, 'u', "use line and row number instead of character index when printing annotation");
     parser.add(config::EnableLog, 'L', "enable logging");
+    parser.add<std::string>(config::Cache, 'c', "reuse Parse Results stored in given directory", false);
 
     std::stringstream ss;
 
@@ -91,6 +93,7 @@ void ParseCommadLineOptions(int argc, const char* argv[], /* out */ Config& conf
     conf.output = parser.get<std::string>(config::Output);
     conf.sourceMap = parser.exist(config::Sourcemap);
     conf.enableLog = parser.exist(config::EnableLog);
+    conf.cacheDir = parser.get<std::string>(config::Cache);
 
     ValidateParsedCommandLine(parser, conf);
 }
@@ -21,6 +21,7 @@ struct Config {
     bool sourceMap;
     std::string output;
     bool enableLog;
+    std::string cacheDir;
 };
 
 /**
@@ -13,9 +13,8 @@
 #include "utils/so/YamlIo.h"
 
 #include "refract/Element.h"
-#include "refract/FilterVisitor.h"
-#include "refract/Query.h"
-#include "refract/Iterate.h"
+#include "refract/Exception.h"
+#include "refract/SerializeCbor.h"
 #include "refract/SerializeSo.h"
 
 #include "SerializeResult.h" // FIXME: remove - actualy required by WrapParseResultRefract()
@@ -32,9 +31,16 @@
 
 #include "reporting.h"
 #include "options.h"
+#include "ParseCache.h"
+#include "ParseProgress.h"
 
+#include <cstdlib>
 #include <cstring>
 #include <cassert>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <string>
 
 DRAFTER_API drafter_error drafter_parse_blueprint_to(const char* source,
     char** out,
@@ -45,6 +51,28 @@ DRAFTER_API drafter_error drafter_parse_blueprint_to(const char* source,
         return DRAFTER_EINVALID_INPUT;
     }
 
+    if (drafter::get_format(serialize_opts) == DRAFTER_SERIALIZE_CBOR) {
+        return DRAFTER_EINVALID_OUTPUT;
+    }
+
+    std::unique_ptr<drafter::ParseCache> cache;
+    std::string cacheKey;
+
+    // a generation policy is code the cache key cannot cover
+    if (out && !drafter::get_gen_policy(parse_opts)) {
+        if (const char* cacheDir = drafter::get_cache_dir(parse_opts)) {
+            const std::size_t maxSize = drafter::get_cache_max_size(parse_opts);
+            cache.reset(new drafter::ParseCache(cacheDir, maxSize ? maxSize : drafter::ParseCache::DefaultMaxSize));
+            cacheKey = drafter::ParseCache::key(source, std::strlen(source), parse_opts, serialize_opts);
+
+            drafter::ParseCache::Entry entry;
+            if (cache->load(cacheKey, entry)) {
+                *out = strdup(entry.output.c_str());
+                return static_cast<drafter_error>(entry.code);
+            }
+        }
+    }
+
     drafter_result* result = nullptr;
 
     drafter_error ret = drafter_parse_blueprint(source, &result, parse_opts);
@@ -55,6 +83,14 @@ DRAFTER_API drafter_error drafter_parse_blueprint_to(const char* source,
 
     if (out) {
         *out = drafter_serialize(result, serialize_opts);
+
+        // a result stopped by a limit may depend on timing
+        if (cache && *out && ret != static_cast<drafter_error>(snowcrash::LimitError)) {
+            drafter::ParseCache::Entry entry;
+            entry.code = ret;
+            entry.output = *out;
+            cache->store(cacheKey, entry);
+        }
     }
 
     drafter_free_result(result);
@@ -64,103 +100,396 @@ DRAFTER_API drafter_error drafter_parse_blueprint_to(const char* source,
 
 namespace sc = snowcrash;
 
+struct drafter_parser {
+    snowcrash::Parser blueprintParser;
+    std::string assetBuffer;
+};
+
 /* Parse API Bleuprint and return result, which is a opaque handle for
  * later use*/
 DRAFTER_API drafter_error drafter_parse_blueprint(
     const char* source, drafter_result** out, const drafter_parse_options* parse_opts)
 {
-    if (!source) {
+    drafter_parser parser;
+    return drafter_parser_parse_blueprint(&parser, source, out, parse_opts);
+}
+
+namespace
+{
+    using WrapFn = std::unique_ptr<refract::IElement> (*)(
+        snowcrash::ParseResult<snowcrash::Blueprint>&, drafter::ConversionContext&);
+
+    drafter_error parseWith(drafter_parser& parser,
+        const char* source,
+        size_t size,
+        drafter_result** out,
+        const drafter_parse_options* parse_opts,
+        WrapFn wrap)
+    {
+        const auto start = drafter::ConversionBudget::clock::now();
+
+        sc::BlueprintParserOptions scOptions = sc::ExportSourcemapOption;
+
+        if (drafter::is_name_required(parse_opts)) {
+            scOptions |= sc::RequireBlueprintNameOption;
+        }
+
+        // the only copy of the source, shared by parsing and conversion
+        const mdp::ByteBuffer buffer(source, size);
+
+        drafter::ParseProgress progress(parse_opts, size);
+
+        // the time limit covers parsing too, conversion has a budget of its own
+        const drafter::ConversionBudget parseBudget(parse_opts, start);
+
+        if (progress.active() || drafter::get_limits(parse_opts).time_ms) {
+            parser.blueprintParser.setProgressCallback([&progress, &parseBudget](size_t offset) { //
+                parseBudget.checkTime();
+                return progress.advance(DRAFTER_PROGRESS_PARSING, offset);
+            });
+        } else {
+            parser.blueprintParser.setProgressCallback(sc::ProgressCallback());
+        }
+
+        sc::ParseResult<sc::Blueprint> blueprint;
+        parser.blueprintParser.setConcurrency(drafter::get_concurrency(parse_opts));
+        parser.blueprintParser.parse(buffer, scOptions, blueprint);
+
+        // the callback refers to the progress of this parse only
+        parser.blueprintParser.setProgressCallback(sc::ProgressCallback());
+
+        // a parse cancelled at any point is not converted
+        if (blueprint.report.error.code == sc::CancellationError
+            || (progress.active() && !progress.advance(DRAFTER_PROGRESS_PARSING, size))) {
+            if (out) {
+                *out = nullptr;
+            }
+            return DRAFTER_ECANCELLED;
+        }
+
+        drafter::ConversionContext context(buffer.c_str(), parse_opts, std::move(parser.assetBuffer), start);
+
+        if (progress.active()) {
+            context.progress(&progress);
+        }
+
+        auto result = wrap(blueprint, context);
+        parser.assetBuffer = context.releaseAssetBuffer();
+
+        if (progress.active() && !progress.advance(DRAFTER_PROGRESS_CONVERTING, size)) {
+            if (out) {
+                *out = nullptr;
+            }
+            return DRAFTER_ECANCELLED;
+        }
+
+        if (out) {
+            *out = result.release();
+        }
+
+        return (drafter_error)blueprint.report.error.code;
+    }
+} // namespace
+
+DRAFTER_API drafter_error drafter_parser_parse_blueprint(
+    drafter_parser* parser, const char* source, drafter_result** out, const drafter_parse_options* parse_opts)
+{
+    if (!parser || !source) {
         return DRAFTER_EINVALID_INPUT;
     }
 
-    sc::BlueprintParserOptions scOptions = sc::ExportSourcemapOption;
+    return parseWith(*parser, source, strlen(source), out, parse_opts, drafter::WrapRefract);
+}
+
+DRAFTER_API drafter_error drafter_parse_blueprint_n(
+    const char* source, size_t size, drafter_result** out, const drafter_parse_options* parse_opts)
+{
+    drafter_parser parser;
+    return drafter_parser_parse_blueprint_n(&parser, source, size, out, parse_opts);
+}
 
-    if (drafter::is_name_required(parse_opts)) {
-        scOptions |= sc::RequireBlueprintNameOption;
+DRAFTER_API drafter_error drafter_parser_parse_blueprint_n(drafter_parser* parser,
+    const char* source,
+    size_t size,
+    drafter_result** out,
+    const drafter_parse_options* parse_opts)
+{
+    if (!parser || (!source && size)) {
+        return DRAFTER_EINVALID_INPUT;
     }
 
-    sc::ParseResult<sc::Blueprint> blueprint;
-    sc::parse(source, scOptions, blueprint);
+    return parseWith(*parser, source ? source : "", size, out, parse_opts, drafter::WrapRefract);
+}
 
-    drafter::ConversionContext context(source, parse_opts);
-    auto result = WrapRefract(blueprint, context);
+DRAFTER_API drafter_parser* drafter_init_parser(void)
+{
+    return new drafter_parser{};
+}
 
-    if (out) {
-        *out = result.release();
+DRAFTER_API void drafter_free_parser(drafter_parser* parser)
+{
+    delete parser;
+}
+
+namespace
+{
+    ///
+    /// Stream buffer passing its contents to a write callback in chunks
+    ///
+    class WriteCallbackBuf : public std::streambuf
+    {
+        drafter_write_fn write_;
+        void* ctx_;
+        size_t written_ = 0;
+        bool failed_ = false;
+        char buffer_[16 * 1024];
+
+    public:
+        WriteCallbackBuf(drafter_write_fn write, void* ctx) : write_(write), ctx_(ctx)
+        {
+            setp(buffer_, buffer_ + sizeof buffer_);
+        }
+
+        /// Pass data on bypassing the buffer
+        bool write(const char* data, size_t size)
+        {
+            if (failed_ || !flush() || !size)
+                return !failed_;
+
+            if (write_(ctx_, data, size) != 0)
+                failed_ = true;
+            else
+                written_ += size;
+
+            return !failed_;
+        }
+
+        bool flush()
+        {
+            const size_t pending = pptr() - pbase();
+            setp(buffer_, buffer_ + sizeof buffer_);
+
+            if (pending)
+                write(buffer_, pending);
+
+            return !failed_;
+        }
+
+        size_t written() const noexcept
+        {
+            return written_;
+        }
+
+    protected:
+        int_type overflow(int_type ch) override
+        {
+            if (!flush())
+                return traits_type::eof();
+
+            if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+                *pptr() = traits_type::to_char_type(ch);
+                pbump(1);
+            }
+
+            return traits_type::not_eof(ch);
+        }
+
+        int sync() override
+        {
+            return flush() ? 0 : -1;
+        }
+    };
+
+    int appendToString(void* ctx, const char* data, size_t size)
+    {
+        static_cast<std::string*>(ctx)->append(data, size);
+        return 0;
     }
 
-    return (drafter_error)blueprint.report.error.code;
-}
+    void serializeYaml(const drafter_result& res, bool sourceMaps, WriteCallbackBuf& sink)
+    {
+        std::ostream out(&sink);
+        drafter::utils::so::serialize_yaml(out, refract::serialize::renderSo(res, sourceMaps));
+    }
+
+    /// Serialize into a string
+    void serializeTo(const drafter_result& res, const drafter_serialize_options* serialize_opts, std::string& out)
+    {
+        const bool sourceMaps = drafter::are_sourcemaps_included(serialize_opts);
+
+        switch (drafter::get_format(serialize_opts)) {
+            case DRAFTER_SERIALIZE_JSON:
+                drafter::utils::so::serialize_json(out, refract::serialize::renderSo(res, sourceMaps));
+                break;
+
+            case DRAFTER_SERIALIZE_YAML: {
+                WriteCallbackBuf sink(appendToString, &out);
+                serializeYaml(res, sourceMaps, sink);
+                sink.flush();
+                break;
+            }
+
+            case DRAFTER_SERIALIZE_CBOR:
+                out = refract::serialize::renderCbor(res, sourceMaps);
+                break;
+        }
+    }
+
+    /// Serialize into a write callback; JSON and YAML are passed on while
+    ///     being written, CBOR once complete
+    /// @return whether the callback accepted all of the output
+    bool serializeTo(const drafter_result& res, const drafter_serialize_options* serialize_opts, WriteCallbackBuf& sink)
+    {
+        const bool sourceMaps = drafter::are_sourcemaps_included(serialize_opts);
+
+        switch (drafter::get_format(serialize_opts)) {
+            case DRAFTER_SERIALIZE_JSON: {
+                std::ostream out(&sink);
+                drafter::utils::so::serialize_json(out, refract::serialize::renderSo(res, sourceMaps));
+                return sink.flush();
+            }
+
+            case DRAFTER_SERIALIZE_YAML:
+                serializeYaml(res, sourceMaps, sink);
+                return sink.flush();
+
+            case DRAFTER_SERIALIZE_CBOR:
+                break;
+        }
+
+        const std::string out = refract::serialize::renderCbor(res, sourceMaps);
+        return sink.write(out.data(), out.size());
+    }
+
+    /// Copy to a null-terminated buffer to be released by free()
+    char* mallocCopy(const std::string& out)
+    {
+        char* result = static_cast<char*>(malloc(out.size() + 1));
+        if (!result) {
+            return nullptr;
+        }
+
+        memcpy(result, out.data(), out.size());
+        result[out.size()] = '\0';
+
+        return result;
+    }
+} // namespace
 
 /* Serialize result to given format*/
 DRAFTER_API char* drafter_serialize(drafter_result* res, const drafter_serialize_options* serialize_opts)
+{
+    if (!res || drafter::get_format(serialize_opts) == DRAFTER_SERIALIZE_CBOR) {
+        return nullptr;
+    }
+
+    return drafter_serialize_n(res, serialize_opts, nullptr);
+}
+
+/* Serialize result to given format, including binary ones */
+DRAFTER_API char* drafter_serialize_n(
+    drafter_result* res, const drafter_serialize_options* serialize_opts, size_t* size)
 {
     if (!res) {
         return nullptr;
     }
 
-    std::ostringstream out;
+    std::string out;
+    serializeTo(*res, serialize_opts, out);
 
-    switch (drafter::get_format(serialize_opts)) {
-        case DRAFTER_SERIALIZE_JSON: {
-            auto soValue = refract::serialize::renderSo(*res, drafter::are_sourcemaps_included(serialize_opts));
-            drafter::utils::so::serialize_json(out, soValue);
-            break;
-        }
-        case DRAFTER_SERIALIZE_YAML: {
-            auto soValue = refract::serialize::renderSo(*res, drafter::are_sourcemaps_included(serialize_opts));
-            drafter::utils::so::serialize_yaml(out, soValue);
-            break;
-        }
+    char* result = mallocCopy(out);
 
-        default:
-            return nullptr;
+    if (result && size) {
+        *size = out.size();
     }
 
-    return strdup(out.str().c_str());
+    return result;
 }
 
-/* Parse API Blueprint and return only annotations, if NULL than
- * document is error and warning free.*/
-DRAFTER_API drafter_error drafter_check_blueprint(
-    const char* source, drafter_result** res, const drafter_parse_options* parse_opts)
+/* Serialize result to given format into a write callback */
+DRAFTER_API drafter_error drafter_serialize_write(drafter_result* res,
+    const drafter_serialize_options* serialize_opts,
+    drafter_write_fn write,
+    void* ctx,
+    size_t* size)
 {
-    if (!source) {
+    if (!res || !write) {
         return DRAFTER_EINVALID_INPUT;
     }
 
-    drafter_result* result = nullptr;
+    WriteCallbackBuf sink(write, ctx);
+    const bool written = serializeTo(*res, serialize_opts, sink);
 
-    drafter_error ret = res ? drafter_parse_blueprint(source, &result, parse_opts) :
-                              drafter_parse_blueprint(source, nullptr, parse_opts);
+    if (size) {
+        *size = sink.written();
+    }
 
-    if (!result) {
-        return ret;
+    return written ? DRAFTER_OK : DRAFTER_EINVALID_OUTPUT;
+}
+
+/* Restore result from its JSON or CBOR serialization */
+DRAFTER_API drafter_error drafter_deserialize(const char* data, size_t size, drafter_result** out)
+{
+    if (!data || !out) {
+        return DRAFTER_EINVALID_INPUT;
     }
 
-    drafter_result* out = nullptr;
+    // CBOR documents start with the self-describe tag, JSON never does
+    const bool isCbor = size >= 3 && memcmp(data, "\xd9\xd9\xf7", 3) == 0;
 
-    refract::FilterVisitor filter(refract::query::Element("annotation"));
-    refract::Iterate<refract::Children> iterate(filter);
-    iterate(*result);
+    try {
+        if (isCbor) {
+            *out = refract::serialize::parseCbor(data, size).release();
+        } else {
+            *out = refract::serialize::parseSo(drafter::utils::so::parse_json(data, size)).release();
+        }
+    } catch (const refract::DeserializationError&) {
+        return DRAFTER_EINVALID_INPUT;
+    } catch (const drafter::utils::so::JsonParseError&) {
+        return DRAFTER_EINVALID_INPUT;
+    }
 
-    if (!filter.empty()) {
-        refract::ArrayElement::ValueType elements;
+    return DRAFTER_OK;
+}
 
-        std::transform(filter.elements().begin(),
-            filter.elements().end(),
-            std::back_inserter(elements),
-            std::bind(&refract::IElement::clone, std::placeholders::_1, refract::IElement::cAll));
+/* Parse API Blueprint and return only annotations, if NULL than
+ * document is error and warning free.*/
+DRAFTER_API drafter_error drafter_check_blueprint(
+    const char* source, drafter_result** res, const drafter_parse_options* parse_opts)
+{
+    drafter_parser parser;
+    return drafter_parser_check_blueprint(&parser, source, res, parse_opts);
+}
 
-        out = new refract::ArrayElement(elements);
-        out->element(drafter::SerializeKey::ParseResult);
+DRAFTER_API drafter_error drafter_parser_check_blueprint(
+    drafter_parser* parser, const char* source, drafter_result** res, const drafter_parse_options* parse_opts)
+{
+    if (!parser || !source) {
+        return DRAFTER_EINVALID_INPUT;
     }
 
-    drafter_free_result(result);
+    // annotations are collected without building the API Elements tree
+    return parseWith(*parser, source, strlen(source), res, parse_opts, drafter::WrapAnnotations);
+}
 
-    *res = out;
+DRAFTER_API drafter_error drafter_check_blueprint_n(
+    const char* source, size_t size, drafter_result** res, const drafter_parse_options* parse_opts)
+{
+    drafter_parser parser;
+    return drafter_parser_check_blueprint_n(&parser, source, size, res, parse_opts);
+}
 
-    return ret;
+DRAFTER_API drafter_error drafter_parser_check_blueprint_n(drafter_parser* parser,
+    const char* source,
+    size_t size,
+    drafter_result** res,
+    const drafter_parse_options* parse_opts)
+{
+    if (!parser || (!source && size)) {
+        return DRAFTER_EINVALID_INPUT;
+    }
+
+    return parseWith(*parser, source ? source : "", size, res, parse_opts, drafter::WrapAnnotations);
 }
 
 DRAFTER_API void drafter_free_result(drafter_result* result)
@@ -196,6 +525,68 @@ DRAFTER_API void drafter_set_skip_gen_body_schemas(drafter_parse_options* opts)
     opts->flags.set(drafter_parse_options::SKIP_GEN_BODY_SCHEMAS);
 }
 
+DRAFTER_API void drafter_set_cache(drafter_parse_options* opts, const char* dir, size_t max_size)
+{
+    assert(opts);
+    opts->cache_dir = dir ? dir : "";
+    opts->cache_max_size = max_size;
+}
+
+DRAFTER_API void drafter_set_concurrency(drafter_parse_options* opts, unsigned int threads)
+{
+    assert(opts);
+    opts->concurrency = threads;
+}
+
+DRAFTER_API void drafter_set_limits(drafter_parse_options* opts,
+    unsigned int max_depth,
+    size_t max_elements,
+    size_t max_asset_size,
+    unsigned int max_time_ms)
+{
+    assert(opts);
+    opts->limits.expansion_depth = max_depth;
+    opts->limits.expanded_elements = max_elements;
+    opts->limits.asset_size = max_asset_size;
+    opts->limits.time_ms = max_time_ms;
+}
+
+DRAFTER_API void drafter_set_gen_policy(drafter_parse_options* opts, drafter_gen_policy_fn policy, void* ctx)
+{
+    assert(opts);
+    opts->gen_policy = policy;
+    opts->gen_policy_ctx = ctx;
+}
+
+DRAFTER_API drafter_cancel_token* drafter_init_cancel_token(void)
+{
+    return new drafter_cancel_token{};
+}
+
+DRAFTER_API void drafter_free_cancel_token(drafter_cancel_token* token)
+{
+    delete token;
+}
+
+DRAFTER_API void drafter_cancel(drafter_cancel_token* token)
+{
+    assert(token);
+    token->cancelled.store(true, std::memory_order_relaxed);
+}
+
+DRAFTER_API void drafter_set_cancel_token(drafter_parse_options* opts, const drafter_cancel_token* token)
+{
+    assert(opts);
+    opts->cancel_token = token;
+}
+
+DRAFTER_API void drafter_set_progress(drafter_parse_options* opts, drafter_progress_fn progress, void* ctx)
+{
+    assert(opts);
+    opts->progress = progress;
+    opts->progress_ctx = ctx;
+}
+
 DRAFTER_API drafter_serialize_options* drafter_init_serialize_options()
 {
     return new drafter_serialize_options{};
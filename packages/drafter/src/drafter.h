@@ -31,6 +31,8 @@ extern "C" {
 #endif
 #endif
 
+#include <stddef.h>
+
 #ifndef __cplusplus
 #include <stdbool.h>
 typedef struct drafter_result drafter_result;
@@ -42,13 +44,24 @@ namespace refract
 typedef refract::IElement drafter_result;
 #endif
 
-/* Serialization formats, currently only YAML or JSON */
+/* Serialization formats, YAML, JSON or binary CBOR */
 typedef enum
 {
     DRAFTER_SERIALIZE_YAML = 0,
-    DRAFTER_SERIALIZE_JSON
+    DRAFTER_SERIALIZE_JSON,
+    DRAFTER_SERIALIZE_CBOR
 } drafter_format;
 
+/* Thread safety
+ *
+ * All functions are reentrant: distinct threads may parse, check, serialize
+ * and deserialize concurrently without any external synchronization. The
+ * library keeps no mutable state shared between calls, except for the parse
+ * cache directory, which tolerates concurrent writers. Options and results
+ * may be read by several threads at once, but must not be modified or freed
+ * while another thread uses them.
+ */
+
 /* Parse options
  */
 typedef struct drafter_parse_options drafter_parse_options;
@@ -78,6 +91,110 @@ DRAFTER_API void drafter_set_skip_gen_bodies(drafter_parse_options*);
  */
 DRAFTER_API void drafter_set_skip_gen_body_schemas(drafter_parse_options*);
 
+/* Set cache option
+ *   @remark cache: results of drafter_parse_blueprint_to are stored in and
+ *     served from given directory; least recently used results are removed
+ *     once the directory holds more than max_size bytes (0 for a default of
+ *     64 MiB); the directory may be shared by concurrent processes; parses
+ *     with a gen_policy bypass the cache
+ */
+DRAFTER_API void drafter_set_cache(drafter_parse_options*, const char* dir, size_t max_size);
+
+/* Set concurrency option
+ *   @remark concurrency: top-level sections of the document are parsed,
+ *     then converted by up to given number of threads and assembled in
+ *     document order; the result does not depend on the option (0 or 1 for
+ *     the default, sequential parsing and conversion)
+ */
+DRAFTER_API void drafter_set_concurrency(drafter_parse_options*, unsigned int threads);
+
+/* Set limits option
+ *   @remark limits: conversion stops with an error annotation of code 5
+ *     once expanding a data structure nests deeper than max_depth elements,
+ *     once the data structures of the document expand into more than
+ *     max_elements elements, once a generated body or schema exceeds
+ *     max_asset_size bytes, or once parsing and conversion take longer than
+ *     max_time_ms milliseconds; 0 for no limit, the default
+ */
+DRAFTER_API void drafter_set_limits(drafter_parse_options*,
+    unsigned int max_depth,
+    size_t max_elements,
+    size_t max_asset_size,
+    unsigned int max_time_ms);
+
+/* Assets generated from the attributes of a payload lacking them */
+typedef enum
+{
+    DRAFTER_GEN_BODY = 0,
+    DRAFTER_GEN_BODY_SCHEMA
+} drafter_gen_asset;
+
+/* Generation policy
+ *   @param ctx context passed along with the policy
+ *   @param method HTTP method of the transaction, for responses too
+ *   @param status status code of a response, 0 for a request
+ *   @param media_type normalised media type of the payload including its
+ *     parameters, e.g. "application/json", or "" if it has none
+ *   @return non-zero to generate the asset
+ */
+typedef int (*drafter_gen_policy_fn)(
+    void* ctx, drafter_gen_asset asset, const char* method, unsigned int status, const char* media_type);
+
+/* Set gen_policy option
+ *   @remark gen_policy: a message body or schema payload is generated from
+ *     attributes only if the policy accepts it, besides skip_gen_bodies and
+ *     skip_gen_body_schemas; attributes of a payload the policy accepts
+ *     neither for are not expanded, nor checked for expansion errors; the
+ *     policy may be called by several threads at once if concurrency is set;
+ *     the parse cache is not used with a policy; NULL for none
+ */
+DRAFTER_API void drafter_set_gen_policy(drafter_parse_options*, drafter_gen_policy_fn policy, void* ctx);
+
+/* Cancellation token
+ *   @remark cancels the parses using parse options the token is set to; it
+ *     may be cancelled from any thread and stays cancelled
+ */
+typedef struct drafter_cancel_token drafter_cancel_token;
+
+/* Allocate a cancellation token, not cancelled */
+DRAFTER_API drafter_cancel_token* drafter_init_cancel_token(void);
+
+/* Deallocate a cancellation token, no parse may use it any more */
+DRAFTER_API void drafter_free_cancel_token(drafter_cancel_token*);
+
+/* Cancel the parses using the token
+ *   @remark parses notice at the next section, resource or payload and
+ *     return DRAFTER_ECANCELLED without a result
+ */
+DRAFTER_API void drafter_cancel(drafter_cancel_token*);
+
+/* Set cancel_token option
+ *   @remark cancel_token: parses are cancelled once the token is, NULL for none
+ */
+DRAFTER_API void drafter_set_cancel_token(drafter_parse_options*, const drafter_cancel_token*);
+
+/* Stages of a parse progress is reported for */
+typedef enum
+{
+    DRAFTER_PROGRESS_PARSING = 0,
+    DRAFTER_PROGRESS_CONVERTING
+} drafter_progress_stage;
+
+/* Progress callback
+ *   @param ctx context passed along with the callback
+ *   @param done bytes of the source the stage reached, reported as it reaches
+ *     a section, resource or payload; total once the stage is complete
+ *   @param total size of the source in bytes
+ *   @return 0 to continue, anything else cancels the parse
+ */
+typedef int (*drafter_progress_fn)(void* ctx, drafter_progress_stage stage, size_t done, size_t total);
+
+/* Set progress option
+ *   @remark progress: the callback is called as the parse advances, never
+ *     by several threads at once; NULL for none
+ */
+DRAFTER_API void drafter_set_progress(drafter_parse_options*, drafter_progress_fn progress, void* ctx);
+
 /* Serialisation options
  */
 typedef struct drafter_serialize_options drafter_serialize_options;
@@ -98,7 +215,7 @@ DRAFTER_API void drafter_free_serialize_options(drafter_serialize_options*);
 DRAFTER_API void drafter_set_sourcemaps_included(drafter_serialize_options*);
 
 /* Set format option
- *   @remark format: API Elements serialisation format (YAML|JSON)
+ *   @remark format: API Elements serialisation format (YAML|JSON|CBOR)
  */
 DRAFTER_API void drafter_set_format(drafter_serialize_options*, drafter_format);
 
@@ -108,6 +225,7 @@ typedef enum
     DRAFTER_EUNKNOWN = -1,
     DRAFTER_EINVALID_INPUT = -2,
     DRAFTER_EINVALID_OUTPUT = -3,
+    DRAFTER_ECANCELLED = -4,
 } drafter_error;
 
 /* Parse API Blueprint and serialize it to given format.
@@ -115,6 +233,9 @@ typedef enum
  * - 0 if everything went smooth.
  * - positive numbers if it encountered parsing errors.
  * - negative numbers if it failed to parse due the programming errors like invalid input.
+ *
+ * Binary formats can't be returned as a string, DRAFTER_EINVALID_OUTPUT is
+ * returned for them; use drafter_parse_blueprint with drafter_serialize_n.
  */
 DRAFTER_API drafter_error drafter_parse_blueprint_to(const char* source,
     char** out,
@@ -128,17 +249,64 @@ DRAFTER_API drafter_error drafter_parse_blueprint_to(const char* source,
  * - 0 if everything went smooth.
  * - positive numbers if it encountered parsing errors.
  * - negative numbers if it failed to parse due the programming errors like invalid input.
+ * - DRAFTER_ECANCELLED if the parse was cancelled, out is then NULL.
  */
 DRAFTER_API drafter_error drafter_parse_blueprint(
     const char* source, drafter_result** out, const drafter_parse_options* parse_opts);
 
-/* Serialize result to given format, returns NULL if an error is encountered */
+/* Parse API Blueprint of given length, see drafter_parse_blueprint
+ *   @remark source needs no null termination, e.g. a memory mapped file
+ */
+DRAFTER_API drafter_error drafter_parse_blueprint_n(
+    const char* source, size_t size, drafter_result** out, const drafter_parse_options* parse_opts);
+
+/* Serialize result to given format, returns NULL if an error is encountered
+ * or the format is binary */
 DRAFTER_API char* drafter_serialize(drafter_result* res, const drafter_serialize_options* serialize_opts);
 
+/* Serialize result to given format, including binary ones
+ *   @param size receives the length of the output in bytes, excluding the
+ *   terminating null byte appended to any output
+ *   @return NULL if an error is encountered
+ */
+DRAFTER_API char* drafter_serialize_n(
+    drafter_result* res, const drafter_serialize_options* serialize_opts, size_t* size);
+
+/* Output sink, receives serialized output in consecutive chunks
+ *   @param ctx context passed along with the sink
+ *   @return 0 to continue, anything else aborts the serialization
+ */
+typedef int (*drafter_write_fn)(void* ctx, const char* data, size_t size);
+
+/* Serialize result to given format, including binary ones, passing the
+ * output to a sink instead of allocating it
+ *   @param size receives the number of bytes accepted by the sink, may be NULL
+ * Returns:
+ * - 0 if everything went smooth.
+ * - DRAFTER_EINVALID_INPUT if there is no result or sink.
+ * - DRAFTER_EINVALID_OUTPUT if the sink aborted the serialization.
+ */
+DRAFTER_API drafter_error drafter_serialize_write(drafter_result* res,
+    const drafter_serialize_options* serialize_opts,
+    drafter_write_fn write,
+    void* ctx,
+    size_t* size);
+
+/* Restore result from its JSON or CBOR serialization, the format is detected
+ * Returns:
+ * - 0 if everything went smooth.
+ * - negative numbers if data isn't a serialization of a result.
+ */
+DRAFTER_API drafter_error drafter_deserialize(const char* data, size_t size, drafter_result** out);
+
 /* Free memory allocated for result handler */
 DRAFTER_API void drafter_free_result(drafter_result* res);
 
 /* Parse API Blueprint and return only annotations.
+ * Neither the API Elements tree nor message body and schema assets are
+ * generated, unless drafter_set_limits bounds their size or the time and
+ * they are generated and discarded; annotations are the same
+ * drafter_parse_blueprint reports.
  * Returns:
  * - 0 if everything went smooth.
  * - positive numbers if it encountered parsing errors, which are described in the result
@@ -147,6 +315,46 @@ DRAFTER_API void drafter_free_result(drafter_result* res);
 DRAFTER_API drafter_error drafter_check_blueprint(
     const char* source, drafter_result** res, const drafter_parse_options* parse_opts);
 
+/* Parse API Blueprint of given length and return only annotations,
+ * see drafter_check_blueprint and drafter_parse_blueprint_n */
+DRAFTER_API drafter_error drafter_check_blueprint_n(
+    const char* source, size_t size, drafter_result** res, const drafter_parse_options* parse_opts);
+
+/* Reusable parser
+ *   @remark keeps its Markdown renderer and working buffers between
+ *     documents, sparing their setup when parsing many small ones; a parser
+ *     must not be used by several threads at once
+ */
+typedef struct drafter_parser drafter_parser;
+
+/* Allocate a reusable parser */
+DRAFTER_API drafter_parser* drafter_init_parser(void);
+
+/* Free memory allocated for a reusable parser */
+DRAFTER_API void drafter_free_parser(drafter_parser*);
+
+/* Parse API Blueprint with a reusable parser, see drafter_parse_blueprint */
+DRAFTER_API drafter_error drafter_parser_parse_blueprint(
+    drafter_parser* parser, const char* source, drafter_result** out, const drafter_parse_options* parse_opts);
+
+/* Parse API Blueprint with a reusable parser and return only annotations,
+ * see drafter_check_blueprint */
+DRAFTER_API drafter_error drafter_parser_check_blueprint(
+    drafter_parser* parser, const char* source, drafter_result** res, const drafter_parse_options* parse_opts);
+
+/* Length-aware variants of the reusable parser functions above */
+DRAFTER_API drafter_error drafter_parser_parse_blueprint_n(drafter_parser* parser,
+    const char* source,
+    size_t size,
+    drafter_result** out,
+    const drafter_parse_options* parse_opts);
+
+DRAFTER_API drafter_error drafter_parser_check_blueprint_n(drafter_parser* parser,
+    const char* source,
+    size_t size,
+    drafter_result** res,
+    const drafter_parse_options* parse_opts);
+
 DRAFTER_API unsigned int drafter_version(void);
 
 DRAFTER_API const char* drafter_version_string(void);
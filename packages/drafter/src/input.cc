@@ -0,0 +1,100 @@
+//
+//  input.cc
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "input.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DRAFTER_INPUT_MMAP 1
+#endif
+
+InputSource::InputSource(const std::string& file) : data_(nullptr), size_(0), mapping_(nullptr), buffer_()
+{
+#if defined(DRAFTER_INPUT_MMAP)
+    if (file.empty()) {
+        if (map(STDIN_FILENO))
+            return;
+    } else {
+        const int fd = ::open(file.c_str(), O_RDONLY);
+
+        if (fd < 0) {
+            std::cerr << "fatal: unable to open file '" << file << "'\n";
+            exit(EXIT_FAILURE);
+        }
+
+        const bool mapped = map(fd);
+        ::close(fd); // the mapping stays valid
+
+        if (mapped)
+            return;
+    }
+#endif
+
+    if (file.empty()) {
+        read(std::cin);
+        return;
+    }
+
+    std::ifstream in(file, std::ios_base::in | std::ios_base::binary);
+
+    if (!in.is_open()) {
+        std::cerr << "fatal: unable to open file '" << file << "'\n";
+        exit(EXIT_FAILURE);
+    }
+
+    read(in);
+}
+
+InputSource::~InputSource()
+{
+#if defined(DRAFTER_INPUT_MMAP)
+    if (mapping_)
+        ::munmap(mapping_, size_);
+#endif
+}
+
+bool InputSource::map(int fd)
+{
+#if defined(DRAFTER_INPUT_MMAP)
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0)
+        return false;
+
+    const std::size_t size = static_cast<std::size_t>(st.st_size);
+
+    void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED)
+        return false;
+
+    ::madvise(mapping, size, MADV_SEQUENTIAL);
+
+    mapping_ = mapping;
+    data_ = static_cast<const char*>(mapping);
+    size_ = size;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void InputSource::read(std::istream& in)
+{
+    char chunk[64 * 1024];
+
+    while (in.read(chunk, sizeof chunk) || in.gcount() > 0)
+        buffer_.append(chunk, static_cast<std::size_t>(in.gcount()));
+
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+}
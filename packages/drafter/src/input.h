@@ -0,0 +1,59 @@
+//
+//  input.h
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef DRAFTER_INPUT_H
+#define DRAFTER_INPUT_H
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+/**
+ *  \brief Read-only contents of the input document
+ *
+ *  Regular files, including one redirected to standard input, are memory
+ *  mapped; anything else (pipes, terminals, platforms without mmap) is read
+ *  into memory.
+ *
+ *  The contents are not null-terminated.
+ */
+class InputSource
+{
+    const char* data_;
+    std::size_t size_;
+
+    void* mapping_;
+    std::string buffer_;
+
+public:
+    /**
+     *  \brief open the input or report error and exit()
+     *
+     *  \param file - name of file to read, if empty use standard input
+     */
+    explicit InputSource(const std::string& file);
+    ~InputSource();
+
+    InputSource(const InputSource&) = delete;
+    InputSource& operator=(const InputSource&) = delete;
+
+    const char* data() const noexcept
+    {
+        return data_;
+    }
+
+    std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+private:
+    bool map(int fd);
+    void read(std::istream& in);
+};
+
+#endif // #ifndef DRAFTER_INPUT_H
@@ -15,52 +15,92 @@
 
 #include "reporting.h"
 #include "config.h"
+#include "input.h"
 #include "stream.h"
 
 #include "ConversionContext.h"
+#include "ParseCache.h"
 
 #include "utils/log/Trivial.h"
 
 namespace sc = snowcrash;
 
-int ProcessRefract(const Config& config, std::unique_ptr<std::istream>& in, std::unique_ptr<std::ostream>& out)
+int ProcessRefract(const Config& config, const InputSource& source, std::unique_ptr<std::ostream>& out)
 {
     if (config.enableLog)
         ENABLE_LOGGING;
 
-    std::stringstream inputStream;
-    inputStream << in->rdbuf();
-
     drafter_serialize_options* options = drafter_init_serialize_options();
     if (config.sourceMap)
         drafter_set_sourcemaps_included(options);
     if (config.format == drafter::JSONFormat)
         drafter_set_format(options, DRAFTER_SERIALIZE_JSON);
 
-    refract::IElement* result = nullptr;
-
     // TODO: Read parse options from CLI
     drafter_parse_options* parseOptions = drafter_init_parse_options();
-    int ret = drafter_parse_blueprint(inputStream.str().c_str(), &result, parseOptions);
+
+    // the report depends on CLI flags, make them part of the key
+    std::unique_ptr<drafter::ParseCache> cache;
+    std::string cacheKey;
+    if (!config.cacheDir.empty()) {
+        cache.reset(new drafter::ParseCache(config.cacheDir));
+        cacheKey = drafter::ParseCache::key(source.data(),
+            source.size(),
+            parseOptions,
+            options,
+            std::string("cli") + (config.validate ? "l" : "-") + (config.lineNumbers ? "u" : "-"));
+
+        drafter::ParseCache::Entry entry;
+        if (cache->load(cacheKey, entry)) {
+            drafter_free_parse_options(parseOptions);
+            drafter_free_serialize_options(options);
+
+            if (!config.validate)
+                *out << entry.output << "\n" << std::flush;
+            std::cerr << entry.report;
+
+            return entry.code;
+        }
+    }
+
+    refract::IElement* result = nullptr;
+
+    int ret = drafter_parse_blueprint_n(source.data(), source.size(), &result, parseOptions);
     drafter_free_parse_options(parseOptions);
 
     if (!result) {
+        drafter_free_serialize_options(options);
         return -1;
     }
 
+    drafter::ParseCache::Entry entry;
+    entry.code = ret;
+
     if (!config.validate) { // If not validate, we serialize
         char* output = drafter_serialize(result, options);
 
         if (output) {
             *out << output << "\n" << std::flush;
 
+            if (cache)
+                entry.output = output;
+
             free(output);
         }
     }
 
     drafter_free_serialize_options(options);
 
-    PrintReport(result, inputStream.str(), config.lineNumbers, ret);
+    if (cache) {
+        std::ostringstream report;
+        PrintReport(report, result, source.data(), source.size(), config.lineNumbers, ret);
+        entry.report = report.str();
+
+        std::cerr << entry.report;
+        cache->store(cacheKey, entry);
+    } else {
+        PrintReport(result, source.data(), source.size(), config.lineNumbers, ret);
+    }
 
     drafter_free_result(result);
 
@@ -72,7 +112,7 @@ int main(int argc, const char* argv[])
     Config config;
     ParseCommadLineOptions(argc, argv, config);
 
-    std::unique_ptr<std::istream> in(CreateStreamFromName<std::istream>(config.input));
+    const InputSource in(config.input);
     std::unique_ptr<std::ostream> out(CreateStreamFromName<std::ostream>(config.output));
 
     return ProcessRefract(config, in, out);
@@ -31,3 +31,48 @@ bool drafter::is_skip_gen_body_schemas(const drafter_parse_options* opts) noexce
 {
     return opts && opts->flags.test(drafter_parse_options::SKIP_GEN_BODY_SCHEMAS);
 }
+
+const char* drafter::get_cache_dir(const drafter_parse_options* opts) noexcept
+{
+    return (opts && !opts->cache_dir.empty()) ? opts->cache_dir.c_str() : nullptr;
+}
+
+std::size_t drafter::get_cache_max_size(const drafter_parse_options* opts) noexcept
+{
+    return opts ? opts->cache_max_size : 0;
+}
+
+unsigned drafter::get_concurrency(const drafter_parse_options* opts) noexcept
+{
+    return opts ? opts->concurrency : 0;
+}
+
+drafter::parse_limits drafter::get_limits(const drafter_parse_options* opts) noexcept
+{
+    return opts ? opts->limits : parse_limits{};
+}
+
+drafter_gen_policy_fn drafter::get_gen_policy(const drafter_parse_options* opts) noexcept
+{
+    return opts ? opts->gen_policy : nullptr;
+}
+
+void* drafter::get_gen_policy_ctx(const drafter_parse_options* opts) noexcept
+{
+    return opts ? opts->gen_policy_ctx : nullptr;
+}
+
+const drafter_cancel_token* drafter::get_cancel_token(const drafter_parse_options* opts) noexcept
+{
+    return opts ? opts->cancel_token : nullptr;
+}
+
+drafter_progress_fn drafter::get_progress(const drafter_parse_options* opts) noexcept
+{
+    return opts ? opts->progress : nullptr;
+}
+
+void* drafter::get_progress_ctx(const drafter_parse_options* opts) noexcept
+{
+    return opts ? opts->progress_ctx : nullptr;
+}
@@ -11,7 +11,21 @@
 
 #include "drafter.h"
 
+#include <atomic>
 #include <bitset>
+#include <cstddef>
+#include <string>
+
+namespace drafter
+{
+    /// Limits on the work of a parse, 0 for no limit
+    struct parse_limits {
+        unsigned expansion_depth = 0;
+        std::size_t expanded_elements = 0;
+        std::size_t asset_size = 0;
+        unsigned time_ms = 0;
+    };
+}
 
 struct drafter_parse_options {
     using flags_type = std::bitset<3>;
@@ -21,6 +35,24 @@ struct drafter_parse_options {
     static constexpr std::size_t SKIP_GEN_BODY_SCHEMAS = 2;
 
     flags_type flags = 0;
+
+    std::string cache_dir = {};
+    std::size_t cache_max_size = 0;
+
+    unsigned concurrency = 0;
+
+    drafter::parse_limits limits = {};
+
+    drafter_gen_policy_fn gen_policy = nullptr;
+    void* gen_policy_ctx = nullptr;
+
+    const drafter_cancel_token* cancel_token = nullptr;
+    drafter_progress_fn progress = nullptr;
+    void* progress_ctx = nullptr;
+};
+
+struct drafter_cancel_token {
+    std::atomic<bool> cancelled{ false };
 };
 
 struct drafter_serialize_options {
@@ -54,8 +86,55 @@ namespace drafter
      */
     bool is_skip_gen_body_schemas(const drafter_parse_options*) noexcept;
 
+    /* Access cache option
+     *   @remark cache: parse results are stored in and served from given directory
+     *   @return cache directory or nullptr if caching is disabled
+     */
+    const char* get_cache_dir(const drafter_parse_options*) noexcept;
+
+    /* Access cache option
+     *   @return size limit of the cache directory in bytes
+     */
+    std::size_t get_cache_max_size(const drafter_parse_options*) noexcept;
+
+    /* Access concurrency option
+     *   @return number of threads parsing and converting top-level sections,
+     *     0 or 1 if sequential
+     */
+    unsigned get_concurrency(const drafter_parse_options*) noexcept;
+
+    /* Access limits option
+     *   @return limits on the work of a parse, none if options are nullptr
+     */
+    parse_limits get_limits(const drafter_parse_options*) noexcept;
+
+    /* Access gen_policy option
+     *   @return generation policy or nullptr if there is none
+     */
+    drafter_gen_policy_fn get_gen_policy(const drafter_parse_options*) noexcept;
+
+    /* Access gen_policy option
+     *   @return context of the generation policy
+     */
+    void* get_gen_policy_ctx(const drafter_parse_options*) noexcept;
+
+    /* Access cancel_token option
+     *   @return cancellation token or nullptr if there is none
+     */
+    const drafter_cancel_token* get_cancel_token(const drafter_parse_options*) noexcept;
+
+    /* Access progress option
+     *   @return progress callback or nullptr if there is none
+     */
+    drafter_progress_fn get_progress(const drafter_parse_options*) noexcept;
+
+    /* Access progress option
+     *   @return context of the progress callback
+     */
+    void* get_progress_ctx(const drafter_parse_options*) noexcept;
+
     /* Access format option
-     *   @remark format: API Elements serialisation format (YAML|JSON)
+     *   @remark format: API Elements serialisation format (YAML|JSON|CBOR)
      */
     drafter_format get_format(const drafter_serialize_options*) noexcept;
 }
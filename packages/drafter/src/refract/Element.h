@@ -20,6 +20,9 @@
 
 namespace refract
 {
+    bool isReserved(const char* w) noexcept;
+    bool isReserved(const std::string& w) noexcept;
+
     template <typename T, typename... Args>
     std::unique_ptr<T> make_unique(Args&&... args)
     {
@@ -41,6 +44,13 @@ namespace refract
         DataType data_ = {};    //< DSD
 
         std::string name_ = { DataType::name }; //< Name of the Element
+        bool reserved_ = isDefaultReserved();     //< Whether name_ is reserved
+
+        static bool isDefaultReserved() noexcept
+        {
+            static const bool result = isReserved(DataType::name);
+            return result;
+        }
 
     public:
         using ValueType = DataType; //< DSD type definition
@@ -61,7 +71,10 @@ namespace refract
         ///
         /// Initialize a Refract Element from given name and DSD
         ///
-        Element(const std::string& name, DataType data) : hasValue_(true), data_(data), name_(name) {}
+        Element(const std::string& name, DataType data)
+            : hasValue_(true), data_(data), name_(name), reserved_(isReserved(name_))
+        {
+        }
 
         Element(Element&&) = default;
         Element(const Element&) = default;
@@ -109,7 +122,7 @@ namespace refract
             return attributes_;
         }
 
-        std::string element() const override
+        const std::string& element() const noexcept override
         {
             return name_;
         }
@@ -117,6 +130,12 @@ namespace refract
         void element(const std::string& name) override
         {
             name_ = name;
+            reserved_ = isReserved(name_);
+        }
+
+        bool reserved() const noexcept override
+        {
+            return reserved_;
         }
 
         void content(Visitor& v) const override
@@ -133,8 +152,10 @@ namespace refract
         {
             auto el = refract::make_unique<Element>();
 
-            if (flags & IElement::cElement)
-                el->element(name_);
+            if (flags & IElement::cElement) {
+                el->name_ = name_;
+                el->reserved_ = reserved_;
+            }
             if (flags & IElement::cAttributes)
                 el->attributes_ = attributes_;
             if (flags & IElement::cMeta) {
@@ -196,9 +217,6 @@ namespace refract
         visit(element->get(), std::forward<Args>(visitorArgs)...);
         return element;
     }
-
-    bool isReserved(const char* w) noexcept;
-    bool isReserved(const std::string& w) noexcept;
 }
 
 #endif
@@ -69,7 +69,17 @@ namespace refract
         ///
         /// @return Element name
         ///
-        virtual std::string element() const = 0;
+        virtual const std::string& element() const noexcept = 0;
+
+        ///
+        /// Query whether the name of this Element is reserved, i.e. names a
+        /// base Element instead of a named type
+        ///
+        /// @remark classified whenever the name is set
+        ///
+        /// @return true iff isReserved(element())
+        ///
+        virtual bool reserved() const noexcept = 0;
 
         ///
         /// Set name of this Element
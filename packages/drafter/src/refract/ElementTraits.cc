@@ -0,0 +1,146 @@
+//
+//  refract/ElementTraits.cc
+//  librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "ElementTraits.h"
+
+#include "Element.h"
+#include "ElementUtils.h"
+#include <cassert>
+#include <cstring>
+
+using namespace refract;
+
+namespace
+{
+    void scanTypeAttributes(const IElement& e, ElementTraits& traits)
+    {
+        auto typeAttrIt = e.attributes().find("typeAttributes");
+        if (typeAttrIt == e.attributes().end())
+            return;
+
+        const auto* typeAttrs = get<const ArrayElement>(typeAttrIt->second.get());
+        if (!typeAttrs)
+            return;
+
+        for (const auto& el : typeAttrs->get()) {
+            const auto* entry = get<const StringElement>(el.get());
+            if (!entry || entry->empty())
+                continue;
+
+            const char* name = entry->get().get().c_str();
+
+            if (0 == std::strcmp(name, "fixed"))
+                traits.fixed = true;
+            else if (0 == std::strcmp(name, "fixedType"))
+                traits.fixedType = true;
+            else if (0 == std::strcmp(name, "required"))
+                traits.required = true;
+            else if (0 == std::strcmp(name, "optional"))
+                traits.optional = true;
+            else if (0 == std::strcmp(name, "nullable"))
+                traits.nullable = true;
+        }
+    }
+
+    // mirrors refract::inheritsFixed, resolving children through the cache
+    struct InheritsFixedVisitor {
+        ElementTraitsCache& cache;
+        const ElementTraits& traits;
+
+        bool operator()(const ObjectElement&) const noexcept
+        {
+            return true;
+        }
+
+        bool operator()(const NullElement&) const noexcept
+        {
+            return true;
+        }
+
+        bool operator()(const ArrayElement&) const noexcept
+        {
+            return traits.definesValue;
+        }
+
+        bool operator()(const StringElement&) const noexcept
+        {
+            return traits.definesValue;
+        }
+
+        bool operator()(const NumberElement&) const noexcept
+        {
+            return traits.definesValue;
+        }
+
+        bool operator()(const BooleanElement&) const noexcept
+        {
+            return traits.definesValue;
+        }
+
+        bool operator()(const MemberElement& e) const
+        {
+            if (traits.variable)
+                return false;
+
+            if (e.empty())
+                return traits.deflt != nullptr;
+
+            assert(e.get().value());
+            return cache(*e.get().value()).inheritsFixed;
+        }
+
+        bool operator()(const EnumElement& e) const
+        {
+            if (e.empty())
+                return traits.deflt != nullptr;
+
+            assert(e.get().value());
+            return cache(*e.get().value()).inheritsFixed;
+        }
+
+        bool operator()(const ExtendElement& e) const
+        {
+            return cache(cache.merged(e)).inheritsFixed;
+        }
+
+        template <typename ElementT>
+        bool operator()(const ElementT&) const noexcept
+        {
+            return true;
+        }
+    };
+} // namespace
+
+const ElementTraits& ElementTraitsCache::operator()(const IElement& e)
+{
+    auto it = traits_.find(&e);
+    if (it != traits_.end())
+        return it->second;
+
+    ElementTraits result{};
+
+    scanTypeAttributes(e, result);
+    result.variable = isVariable(e);
+    result.firstSample = findFirstSample(e);
+    result.deflt = findDefault(e);
+    result.definesValue = !e.empty() || result.firstSample || result.deflt;
+    result.inheritsFixed = refract::visit(e, InheritsFixedVisitor{ *this, result });
+
+    return traits_.emplace(&e, result).first->second;
+}
+
+const IElement& ElementTraitsCache::merged(const ExtendElement& e)
+{
+    auto it = merged_.find(&e);
+    if (it != merged_.end())
+        return *it->second;
+
+    auto result = e.get().merge();
+    assert(result);
+
+    return *merged_.emplace(&e, std::move(result)).first->second;
+}
@@ -0,0 +1,75 @@
+//
+//  refract/ElementTraits.h
+//  librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef REFRACT_ELEMENT_TRAITS_H
+#define REFRACT_ELEMENT_TRAITS_H
+
+#include "ElementIfc.h"
+#include "ElementFwd.h"
+#include <memory>
+#include <unordered_map>
+
+namespace refract
+{
+    ///
+    /// Facts about an Element consulted by the JSON Value and JSON Schema
+    ///     backends; gathered in a single scan of its attributes
+    ///
+    struct ElementTraits {
+        bool fixed = false;         //< `fixed` type attribute is set
+        bool fixedType = false;     //< `fixedType` type attribute is set
+        bool required = false;      //< `required` type attribute is set
+        bool optional = false;      //< `optional` type attribute is set
+        bool nullable = false;      //< `nullable` type attribute is set
+        bool variable = false;      //< see refract::isVariable
+        bool inheritsFixed = false; //< see refract::inheritsFixed
+        bool definesValue = false;  //< see refract::definesValue
+
+        const IElement* firstSample = nullptr; //< see refract::findFirstSample
+        const IElement* deflt = nullptr;       //< see refract::findDefault
+    };
+
+    ///
+    /// Memoizes ElementTraits and merged Extend Elements of an expanded
+    ///     Element tree
+    ///
+    /// Backends sharing a cache over the same tree analyse every Element
+    /// and merge every Extend Element once, however often they visit it.
+    ///
+    /// @remark the tree must neither be modified nor destroyed while the
+    ///     cache is in use
+    ///
+    class ElementTraitsCache
+    {
+        std::unordered_map<const IElement*, ElementTraits> traits_;
+        std::unordered_map<const ExtendElement*, std::unique_ptr<IElement> > merged_;
+
+    public:
+        ElementTraitsCache() = default;
+
+        ElementTraitsCache(const ElementTraitsCache&) = delete;
+        ElementTraitsCache& operator=(const ElementTraitsCache&) = delete;
+
+        ///
+        /// Query the traits of an Element
+        ///
+        /// @param e    Element within the analysed tree
+        /// @return     traits of given Element
+        ///
+        const ElementTraits& operator()(const IElement& e);
+
+        ///
+        /// Query the result of merging an Extend Element
+        ///
+        /// @param e    Extend Element within the analysed tree
+        /// @return     equivalent of `*e.get().merge()`
+        ///
+        const IElement& merged(const ExtendElement& e);
+    };
+} // namespace refract
+
+#endif
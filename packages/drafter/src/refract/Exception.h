@@ -26,6 +26,10 @@ namespace refract
         explicit Deprecated(const std::string& msg) : std::logic_error(msg) {}
     };
 
+    struct DeserializationError : std::runtime_error {
+        explicit DeserializationError(const std::string& msg) : std::runtime_error(msg) {}
+    };
+
 }; // namespace refract
 
 #endif // #ifndef REFRACT_EXCEPTION_H
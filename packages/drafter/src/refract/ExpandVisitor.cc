@@ -11,12 +11,12 @@
 #include <stack>
 
 #include <functional>
+#include <limits>
 
 #include <sstream>
 
 #include "SourceAnnotation.h"
 
-#include "IsExpandableVisitor.h"
 #include "ExpandVisitor.h"
 #include "TypeQueryVisitor.h"
 #include "VisitorUtils.h"
@@ -33,11 +33,19 @@ namespace refract
     namespace
     {
 
-        bool Expandable(const IElement& e)
+        // named Holder and Null Elements are never expanded, yet make their parent expand
+        bool NeedsExpansion(const std::unique_ptr<IElement>& expanded, const IElement* e)
         {
-            IsExpandableVisitor v;
-            VisitBy(e, v);
-            return v.get();
+            return expanded || (e && !e->reserved());
+        }
+
+        std::unique_ptr<IElement> ExpandedOrClone(std::unique_ptr<IElement>& expanded, const IElement* e)
+        {
+            if (expanded || !e) {
+                return std::move(expanded);
+            }
+
+            return e->clone();
         }
 
         void CopyMetaId(IElement& dst, const IElement& src)
@@ -160,22 +168,97 @@ namespace refract
         ExpandVisitor* expand;
         std::deque<std::string> members;
 
-        Context(const Registry& registry, ExpandVisitor* expand) : registry(registry), expand(expand) {}
+        const ExpandLimits limits;
+        const unsigned maxDepth;
+        const std::size_t maxVisited;
+        unsigned depth = 0;
+        std::size_t visited = 0;
+
+        Context(const Registry& registry, ExpandVisitor* expand, ExpandLimits limits)
+            : registry(registry),
+              expand(expand),
+              limits(std::move(limits)),
+              maxDepth(this->limits.depth ? this->limits.depth : std::numeric_limits<unsigned>::max()),
+              maxVisited(this->limits.elements ? this->limits.elements : std::numeric_limits<std::size_t>::max())
+        {
+        }
+
+        // every expanded element passes through here, so do the limits
+        void Enter()
+        {
+            if (++visited > maxVisited) {
+                throw snowcrash::Error("data structures expand into too many elements", snowcrash::LimitError);
+            }
+
+            if (++depth > maxDepth) {
+                std::stringstream msg;
+                msg << "data structure expansion nests deeper than " << maxDepth << " elements";
+                throw snowcrash::Error(msg.str(), snowcrash::LimitError);
+            }
+
+            if (limits.poll && visited % ExpandLimits::PollInterval == 0) {
+                limits.poll();
+            }
+        }
 
-        std::unique_ptr<IElement> ExpandOrClone(const IElement* e) const
+        // return expanded element or nullptr if e needs no expansion
+        std::unique_ptr<IElement> Expand(const IElement* e)
         {
             if (!e) {
                 return nullptr;
             }
 
+            Enter();
             VisitBy(*e, *expand);
-            auto result = expand->get();
+            --depth;
+
+            return expand->get();
+        }
+
+        std::unique_ptr<IElement> ExpandOrClone(const IElement* e)
+        {
+            if (!e) {
+                return nullptr;
+            }
+
+            if (auto result = Expand(e)) {
+                return result;
+            }
+
+            return e->clone();
+        }
+
+        ///
+        /// Expand entries of a list DSD bottom-up
+        ///
+        /// Every entry is expanded exactly once; whether the list needs
+        /// expansion follows from the results, so no subtree is scanned
+        /// in advance.
+        ///
+        /// @return false if no entry needs expansion; result is untouched
+        ///
+        template <typename V, typename Insert>
+        bool ExpandEntries(const V& value, Insert insert)
+        {
+            std::vector<std::unique_ptr<IElement> > expanded;
+            expanded.reserve(value.size());
+
+            bool any = false;
+            for (const auto& entry : value) {
+                expanded.push_back(Expand(entry.get()));
+                any = NeedsExpansion(expanded.back(), entry.get()) || any;
+            }
 
-            if (!result) {
-                result = e->clone();
+            if (!any) {
+                return false;
             }
 
-            return result;
+            auto it = expanded.begin();
+            for (const auto& entry : value) {
+                insert(ExpandedOrClone(*it++, entry.get()));
+            }
+
+            return true;
         }
 
         template <typename V>
@@ -273,7 +356,7 @@ namespace refract
     struct ExpandElement {
         std::unique_ptr<IElement> operator()(const T& e, ExpandVisitor::Context* context)
         {
-            if (!isReserved(e.element().c_str())) { // expand named type
+            if (!e.reserved()) { // expand named type
                 return context->ExpandNamedType(e);
             }
             return nullptr;
@@ -292,27 +375,39 @@ namespace refract
     struct ExpandElement<EnumElement, EnumElement::ValueType, false> {
         std::unique_ptr<IElement> operator()(const EnumElement& e, ExpandVisitor::Context* context)
         {
-            if (!isReserved(e.element().c_str()))
+            if (!e.reserved())
                 return context->ExpandNamedType(e);
 
+            std::unique_ptr<IElement> value = e.empty() ? nullptr : context->Expand(e.get().value());
+            bool expandable = !e.empty() && NeedsExpansion(value, e.get().value());
+
+            dsd::Array enumerations;
+            const auto enums = e.attributes().find("enumerations");
+            if (enums != e.attributes().end()) {
+                const auto* array = TypeQueryVisitor::as<const ArrayElement>(enums->second.get());
+                assert(array);
+                assert(!array->empty());
+
+                expandable = context->ExpandEntries(array->get(),
+                                 [&enumerations](std::unique_ptr<IElement> entry) {
+                                     enumerations.push_back(std::move(entry));
+                                 })
+                    || expandable;
+            }
+
+            if (!expandable) {
+                return nullptr;
+            }
+
             auto o = e.empty() ? //
                 make_empty<EnumElement>() :
-                make_element<EnumElement>(context->ExpandValue(e.get()));
+                make_element<EnumElement>(dsd::Enum{ ExpandedOrClone(value, e.get().value()) });
 
             o->meta() = e.meta();
 
             for (const auto& attribute : e.attributes()) {
-                if (attribute.first == "enumerations") {
-                    const auto* enums = TypeQueryVisitor::as<const ArrayElement>(attribute.second.get());
-                    assert(enums);
-                    assert(!enums->empty());
-
-                    dsd::Array expanded;
-                    for (const auto& entry : enums->get()) {
-                        assert(entry);
-                        expanded.push_back(context->ExpandOrClone(entry.get()));
-                    }
-                    o->attributes().set("enumerations", make_element<ArrayElement>(std::move(expanded)));
+                if (attribute.first == "enumerations" && !enumerations.empty()) {
+                    o->attributes().set("enumerations", make_element<ArrayElement>(std::move(enumerations)));
                 } else {
                     o->attributes().set(attribute.first, attribute.second->clone());
                 }
@@ -326,20 +421,23 @@ namespace refract
     struct ExpandElement<T, dsd::Select, true> {
         std::unique_ptr<IElement> operator()(const T& e, ExpandVisitor::Context* context)
         {
-            if (!Expandable(e)) { // do we have some expandable members?
-                return nullptr;
-            }
-
             auto o = make_element<T>();
             auto& content = o->get();
 
-            o->meta() = e.meta(); // clone
+            const auto insert = [&content](std::unique_ptr<IElement> opt) {
+                content.push_back(std::unique_ptr<OptionElement>(static_cast<OptionElement*>(opt.release())));
+            };
 
-            for (const auto& opt : e.get()) {
-                content.push_back(std::unique_ptr<OptionElement>(
-                    static_cast<OptionElement*>(context->ExpandOrClone(opt.get()).release())));
+            if (!e.reserved()) {
+                if (!e.empty())
+                    for (const auto& opt : e.get())
+                        insert(context->ExpandOrClone(opt.get()));
+            } else if (e.empty() || !context->ExpandEntries(e.get(), insert)) {
+                return nullptr; // no expandable options
             }
 
+            o->meta() = e.meta(); // clone
+
             return std::move(o);
         }
     };
@@ -348,20 +446,28 @@ namespace refract
     struct ExpandElement<T, V, true> {
         std::unique_ptr<IElement> operator()(const T& e, ExpandVisitor::Context* context)
         {
-            if (!Expandable(e)) { // do we have some expandable members?
-                return nullptr;
+            if (!e.reserved()) { // expand named type
+                return context->ExpandNamedType(e);
             }
 
-            std::string en = e.element();
+            if (e.empty()) {
+                return nullptr;
+            }
 
-            if (!isReserved(en.c_str())) { // expand named type
-                return context->ExpandNamedType(e);
-            } else { // walk throught members and expand them
-                return context->ExpandMembers(e);
+            // walk throught members and expand them
+            V members;
+            if (!context->ExpandEntries(e.get(), [&members](std::unique_ptr<IElement> entry) {
+                    members.push_back(std::move(entry));
+                })) {
+                return nullptr; // no expandable members
             }
 
-            // it should never happen
-            assert(0);
+            auto o = make_element<T>(std::move(members));
+
+            o->attributes() = e.attributes();
+            o->meta() = e.meta();
+
+            return std::move(o);
         }
     };
 
@@ -369,14 +475,31 @@ namespace refract
     struct ExpandElement<T, dsd::Member, false> {
         std::unique_ptr<IElement> operator()(const T& e, ExpandVisitor::Context* context)
         {
-            if (!Expandable(e)) {
-                return nullptr;
+            std::unique_ptr<IElement> key = nullptr;
+            std::unique_ptr<IElement> value = nullptr;
+
+            if (!e.reserved()) {
+                key = context->ExpandOrClone(e.get().key());
+                value = context->ExpandOrClone(e.get().value());
+            } else {
+                if (e.empty()) {
+                    return nullptr;
+                }
+
+                key = context->Expand(e.get().key());
+                value = context->Expand(e.get().value());
+
+                if (!NeedsExpansion(key, e.get().key()) && !NeedsExpansion(value, e.get().value())) {
+                    return nullptr;
+                }
+
+                key = ExpandedOrClone(key, e.get().key());
+                value = ExpandedOrClone(value, e.get().value());
             }
 
             auto expanded = clone(e, IElement::cAll ^ IElement::cValue);
 
-            expanded->set(
-                dsd::Member{ context->ExpandOrClone(e.get().key()), context->ExpandOrClone(e.get().value()) });
+            expanded->set(dsd::Member{ std::move(key), std::move(value) });
 
             return std::move(expanded);
         }
@@ -388,7 +511,8 @@ namespace refract
         return ExpandElement<T>()(e, context);
     }
 
-    ExpandVisitor::ExpandVisitor(const Registry& registry) : result(nullptr), context(new Context(registry, this)){};
+    ExpandVisitor::ExpandVisitor(const Registry& registry, ExpandLimits limits)
+        : result(nullptr), context(new Context(registry, this, std::move(limits))){};
 
     ExpandVisitor::~ExpandVisitor()
     {
@@ -422,6 +546,11 @@ namespace refract
     {
         return std::move(result);
     }
+
+    std::size_t ExpandVisitor::visited() const noexcept
+    {
+        return context->visited;
+    }
 }; // namespace refract
 
 #undef VISIT_IMPL
@@ -11,6 +11,8 @@
 
 #include "ElementFwd.h"
 #include "ElementIfc.h"
+#include <cstddef>
+#include <functional>
 #include <memory>
 
 namespace refract
@@ -18,13 +20,25 @@ namespace refract
 
     class Registry;
 
+    ///
+    /// Bounds on an expansion, exceeding one throws snowcrash::Error
+    /// of snowcrash::LimitError code
+    ///
+    struct ExpandLimits {
+        static constexpr std::size_t PollInterval = 4096;
+
+        unsigned depth = 0;         // nesting of expanded elements, 0 for no bound
+        std::size_t elements = 0;   // elements visited, 0 for no bound
+        std::function<void()> poll; // called every PollInterval elements visited, may throw
+    };
+
     class ExpandVisitor
     {
 
     public:
         struct Context;
 
-        ExpandVisitor(const Registry& registry);
+        ExpandVisitor(const Registry& registry, ExpandLimits limits = {});
         ~ExpandVisitor();
 
         void operator()(const IElement& e);
@@ -52,6 +66,9 @@ namespace refract
         // caller responsibility is to delete returned Element
         std::unique_ptr<IElement> get();
 
+        // number of elements visited so far
+        std::size_t visited() const noexcept;
+
     private:
         std::unique_ptr<IElement> result;
         Context* context;
@@ -0,0 +1,33 @@
+//
+//  refract/GenerationContext.cc
+//  librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "GenerationContext.h"
+
+#include "SourceAnnotation.h"
+#include <sstream>
+
+using namespace refract;
+
+GenerationContext::GenerationContext(ElementTraitsCache& traits, const GenerationLimits& limits) noexcept
+    : traits_(traits), limits_(limits)
+{
+}
+
+void GenerationContext::render()
+{
+    ++rendered_;
+
+    if (limits_.size && rendered_ > limits_.size) {
+        std::stringstream msg;
+        msg << "generated asset exceeds " << limits_.size << " bytes";
+        throw snowcrash::Error(msg.str(), snowcrash::LimitError);
+    }
+
+    if (limits_.poll && rendered_ % GenerationLimits::PollInterval == 0) {
+        limits_.poll();
+    }
+}
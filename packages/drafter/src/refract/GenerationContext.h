@@ -0,0 +1,67 @@
+//
+//  refract/GenerationContext.h
+//  librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef REFRACT_GENERATION_CONTEXT_H
+#define REFRACT_GENERATION_CONTEXT_H
+
+#include "ElementFwd.h"
+#include "ElementIfc.h"
+#include "ElementTraits.h"
+#include <cstddef>
+#include <functional>
+
+namespace refract
+{
+    ///
+    /// Bounds on a generated JSON Value or JSON Schema, exceeding one throws
+    ///     snowcrash::Error of snowcrash::LimitError code
+    ///
+    struct GenerationLimits {
+        static constexpr std::size_t PollInterval = 4096;
+
+        std::size_t size = 0;       // bytes of the serialized result, 0 for no bound
+        std::function<void()> poll; // called every PollInterval elements rendered, may throw
+    };
+
+    ///
+    /// State of a JSON Value or JSON Schema generation
+    ///
+    /// Forwards queries to an ElementTraitsCache and accounts for the
+    /// Elements rendered. Each of them adds at least a byte to the
+    /// serialized result, so a generation rendering more Elements than
+    /// GenerationLimits::size is aborted before it completes.
+    ///
+    class GenerationContext
+    {
+        ElementTraitsCache& traits_;
+        const GenerationLimits& limits_;
+        std::size_t rendered_ = 0;
+
+    public:
+        GenerationContext(ElementTraitsCache& traits, const GenerationLimits& limits) noexcept;
+
+        GenerationContext(const GenerationContext&) = delete;
+        GenerationContext& operator=(const GenerationContext&) = delete;
+
+        /// see ElementTraitsCache::operator()
+        const ElementTraits& operator()(const IElement& e)
+        {
+            return traits_(e);
+        }
+
+        /// see ElementTraitsCache::merged
+        const IElement& merged(const ExtendElement& e)
+        {
+            return traits_.merged(e);
+        }
+
+        /// Account for an Element about to be rendered
+        void render();
+    };
+} // namespace refract
+
+#endif
@@ -14,6 +14,8 @@
 #include "Element.h"
 #include "ElementIfc.h"
 #include "ElementUtils.h"
+#include "ElementTraits.h"
+#include "GenerationContext.h"
 #include "ElementSize.h"
 #include "JsonUtils.h"
 #include "JsonValue.h"
@@ -35,18 +37,18 @@ namespace
     constexpr std::size_t NULLABLE_FLAG = 2;
     constexpr std::size_t REQUIRED_FLAG = 3;
 
-    TypeAttributes updateTypeAttributes(const IElement& e, TypeAttributes options) noexcept
+    TypeAttributes updateTypeAttributes(const ElementTraits& traits, TypeAttributes options) noexcept
     {
-        if (hasFixedTypeAttr(e))
+        if (traits.fixed)
             options.set(FIXED_FLAG);
 
-        if (hasFixedTypeTypeAttr(e))
+        if (traits.fixedType)
             options.set(FIXED_TYPE_FLAG);
 
-        if (hasNullableTypeAttr(e))
+        if (traits.nullable)
             options.set(NULLABLE_FLAG);
 
-        if (hasRequiredTypeAttr(e))
+        if (traits.required)
             options.set(REQUIRED_FLAG);
 
         return options;
@@ -65,10 +67,10 @@ namespace
         return options;
     }
 
-    TypeAttributes inheritOrPassFlags(TypeAttributes options, const IElement& e)
+    TypeAttributes inheritOrPassFlags(TypeAttributes options, const IElement& e, GenerationContext& context)
     {
         auto result = inheritFlags(options);
-        if (inheritsFixed(e)) {
+        if (context(e).inheritsFixed) {
             LOG(debug) << "\"" << e.element() << "\"-Element inherits fixed";
             return result;
         }
@@ -216,10 +218,10 @@ namespace
     /// @param e    string data structure element
     /// @return     matching regular expression
     ///
-    std::string renderPattern(const StringElement& e, TypeAttributes options)
+    std::string renderPattern(const StringElement& e, TypeAttributes options, GenerationContext& context)
     {
         // clang-format off
-        if (options.test(FIXED_FLAG) || hasFixedTypeAttr(e)) {
+        if (options.test(FIXED_FLAG) || context(e).fixed) {
             if(e.empty()) {
                 return R"(^(?![\s\S]))";
             } else {
@@ -329,43 +331,71 @@ namespace
 
 namespace
 {
-    void renderPropertySpecific(ObjectSchema& schema, const ArrayElement& element, TypeAttributes options);
-    void renderPropertySpecific(ObjectSchema& schema, const BooleanElement& element, TypeAttributes options);
-    void renderPropertySpecific(ObjectSchema& schema, const EnumElement& element, TypeAttributes options);
-    void renderPropertySpecific(ObjectSchema& schema, const ExtendElement& element, TypeAttributes options);
-    void renderPropertySpecific(ObjectSchema& schema, const HolderElement& element, TypeAttributes options);
-    void renderPropertySpecific(ObjectSchema& schema, const MemberElement& element, TypeAttributes options);
-    void renderPropertySpecific(ObjectSchema& schema, const NullElement& element, TypeAttributes options);
-    void renderPropertySpecific(ObjectSchema& schema, const NumberElement& element, TypeAttributes options);
-    void renderPropertySpecific(ObjectSchema& schema, const ObjectElement& element, TypeAttributes options);
-    void renderPropertySpecific(ObjectSchema& schema, const OptionElement& element, TypeAttributes options);
-    void renderPropertySpecific(ObjectSchema& schema, const RefElement& element, TypeAttributes options);
-    void renderPropertySpecific(ObjectSchema& schema, const SelectElement& element, TypeAttributes options);
-    void renderPropertySpecific(ObjectSchema& schema, const StringElement& element, TypeAttributes options);
-    void renderProperty(ObjectSchema& schema, const IElement& element, TypeAttributes options);
-
-    so::Object& renderSchemaSpecific(so::Object& schema, const ArrayElement& element, TypeAttributes options);
-    so::Object& renderSchemaSpecific(so::Object& schema, const BooleanElement& element, TypeAttributes options);
-    so::Object& renderSchemaSpecific(so::Object& schema, const EnumElement& element, TypeAttributes options);
-    so::Object& renderSchemaSpecific(so::Object& schema, const ExtendElement& element, TypeAttributes options);
-    so::Object& renderSchemaSpecific(so::Object& schema, const HolderElement& element, TypeAttributes options);
-    so::Object& renderSchemaSpecific(so::Object& schema, const MemberElement& element, TypeAttributes options);
-    so::Object& renderSchemaSpecific(so::Object& schema, const NullElement& element, TypeAttributes options);
-    so::Object& renderSchemaSpecific(so::Object& schema, const NumberElement& element, TypeAttributes options);
-    so::Object& renderSchemaSpecific(so::Object& schema, const ObjectElement& element, TypeAttributes options);
-    so::Object& renderSchemaSpecific(so::Object& schema, const OptionElement& element, TypeAttributes options);
-    so::Object& renderSchemaSpecific(so::Object& schema, const RefElement& element, TypeAttributes options);
-    so::Object& renderSchemaSpecific(so::Object& schema, const SelectElement& element, TypeAttributes options);
-    so::Object& renderSchemaSpecific(so::Object& schema, const StringElement& element, TypeAttributes options);
-    so::Object& renderSchema(so::Object& schema, const IElement& element, TypeAttributes options);
+    void renderPropertySpecific(
+        ObjectSchema& schema, const ArrayElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        ObjectSchema& schema, const BooleanElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        ObjectSchema& schema, const EnumElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        ObjectSchema& schema, const ExtendElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        ObjectSchema& schema, const HolderElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        ObjectSchema& schema, const MemberElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        ObjectSchema& schema, const NullElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        ObjectSchema& schema, const NumberElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        ObjectSchema& schema, const ObjectElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        ObjectSchema& schema, const OptionElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        ObjectSchema& schema, const RefElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        ObjectSchema& schema, const SelectElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        ObjectSchema& schema, const StringElement& element, TypeAttributes options, GenerationContext& context);
+    void renderProperty(
+        ObjectSchema& schema, const IElement& element, TypeAttributes options, GenerationContext& context);
+
+    so::Object& renderSchemaSpecific(
+        so::Object& schema, const ArrayElement& element, TypeAttributes options, GenerationContext& context);
+    so::Object& renderSchemaSpecific(
+        so::Object& schema, const BooleanElement& element, TypeAttributes options, GenerationContext& context);
+    so::Object& renderSchemaSpecific(
+        so::Object& schema, const EnumElement& element, TypeAttributes options, GenerationContext& context);
+    so::Object& renderSchemaSpecific(
+        so::Object& schema, const ExtendElement& element, TypeAttributes options, GenerationContext& context);
+    so::Object& renderSchemaSpecific(
+        so::Object& schema, const HolderElement& element, TypeAttributes options, GenerationContext& context);
+    so::Object& renderSchemaSpecific(
+        so::Object& schema, const MemberElement& element, TypeAttributes options, GenerationContext& context);
+    so::Object& renderSchemaSpecific(
+        so::Object& schema, const NullElement& element, TypeAttributes options, GenerationContext& context);
+    so::Object& renderSchemaSpecific(
+        so::Object& schema, const NumberElement& element, TypeAttributes options, GenerationContext& context);
+    so::Object& renderSchemaSpecific(
+        so::Object& schema, const ObjectElement& element, TypeAttributes options, GenerationContext& context);
+    so::Object& renderSchemaSpecific(
+        so::Object& schema, const OptionElement& element, TypeAttributes options, GenerationContext& context);
+    so::Object& renderSchemaSpecific(
+        so::Object& schema, const RefElement& element, TypeAttributes options, GenerationContext& context);
+    so::Object& renderSchemaSpecific(
+        so::Object& schema, const SelectElement& element, TypeAttributes options, GenerationContext& context);
+    so::Object& renderSchemaSpecific(
+        so::Object& schema, const StringElement& element, TypeAttributes options, GenerationContext& context);
+    so::Object& renderSchema(
+        so::Object& schema, const IElement& element, TypeAttributes options, GenerationContext& context);
 }
 
 namespace
 {
-    so::Object makeSchema(const IElement& e, TypeAttributes options)
+    so::Object makeSchema(const IElement& e, TypeAttributes options, GenerationContext& context)
     {
         so::Object result{};
-        renderSchema(result, e, options);
+        renderSchema(result, e, options, context);
         return result;
     }
 } // namespace
@@ -380,26 +410,29 @@ namespace
         return schema;
     }
 
-    so::Object& renderSchemaSpecific(so::Object& s, const HolderElement& e, TypeAttributes options)
+    so::Object& renderSchemaSpecific(
+        so::Object& s, const HolderElement& e, TypeAttributes options, GenerationContext& context)
     {
         if (!e.empty() && e.get().data())
-            return renderSchema(s, *e.get().data(), passFlags(options));
+            return renderSchema(s, *e.get().data(), passFlags(options), context);
         return s;
     }
 
-    so::Object& renderSchemaSpecific(so::Object& s, const RefElement& e, TypeAttributes options)
+    so::Object& renderSchemaSpecific(
+        so::Object& s, const RefElement& e, TypeAttributes options, GenerationContext& context)
     {
         if (const IElement* resolved = resolve(e))
-            return renderSchema(s, *resolved, passFlags(options));
+            return renderSchema(s, *resolved, passFlags(options), context);
         LOG(warning) << "ignoring unresolved reference in backend";
         return s;
     }
 
-    so::Object& renderSchemaSpecific(so::Object& s, const ObjectElement& e, TypeAttributes options)
+    so::Object& renderSchemaSpecific(
+        so::Object& s, const ObjectElement& e, TypeAttributes options, GenerationContext& context)
     {
         constexpr const char* TYPE_NAME = "object";
 
-        options = updateTypeAttributes(e, options);
+        options = updateTypeAttributes(context(e), options);
         auto& schema = wrapNullable(s, options);
 
         addType(schema, TYPE_NAME);
@@ -411,10 +444,12 @@ namespace
             for (const auto& item : e.get()) {
                 assert(item);
                 if (options.test(FIXED_TYPE_FLAG) || options.test(FIXED_FLAG))
-                    renderProperty(
-                        result, *item, inheritOrPassFlags(options, *item) | TypeAttributes{}.set(REQUIRED_FLAG));
+                    renderProperty(result,
+                        *item,
+                        inheritOrPassFlags(options, *item, context) | TypeAttributes{}.set(REQUIRED_FLAG),
+                        context);
                 else
-                    renderProperty(result, *item, inheritOrPassFlags(options, *item));
+                    renderProperty(result, *item, inheritOrPassFlags(options, *item, context), context);
             }
         }
 
@@ -426,11 +461,12 @@ namespace
         return schema;
     }
 
-    so::Object& renderSchemaSpecific(so::Object& s, const ArrayElement& e, TypeAttributes options)
+    so::Object& renderSchemaSpecific(
+        so::Object& s, const ArrayElement& e, TypeAttributes options, GenerationContext& context)
     {
         constexpr const char* TYPE_NAME = "array";
 
-        options = updateTypeAttributes(e, options);
+        options = updateTypeAttributes(context(e), options);
 
         if (options.test(FIXED_TYPE_FLAG)) { // array of any of types
 
@@ -441,13 +477,14 @@ namespace
                 addMaxItems(schema, 0);
             } else if (e.get().size() == 1) {
                 const auto& entry = *e.get().begin();
-                so::Object items = makeSchema(*entry, inheritOrPassFlags(options, *entry));
+                so::Object items = makeSchema(*entry, inheritOrPassFlags(options, *entry, context), context);
                 addItems(schema, std::move(items));
             } else {
                 so::Array items{};
                 for (const auto& entry : e.get()) {
                     assert(entry);
-                    so::emplace_unique(items, makeSchema(*entry, inheritOrPassFlags(options, *entry)));
+                    so::emplace_unique(
+                        items, makeSchema(*entry, inheritOrPassFlags(options, *entry, context), context));
                 }
 
                 addItems(schema, so::Object{ so::from_list{}, std::make_pair("anyOf", std::move(items)) });
@@ -459,7 +496,7 @@ namespace
             if (!e.empty())
                 for (const auto& item : e.get()) {
                     assert(item);
-                    items.data.emplace_back(makeSchema(*item, inheritOrPassFlags(options, *item)));
+                    items.data.emplace_back(makeSchema(*item, inheritOrPassFlags(options, *item, context), context));
                 }
 
             auto& schema = wrapNullable(s, options);
@@ -476,9 +513,10 @@ namespace
         return s;
     }
 
-    so::Object& renderSchemaSpecific(so::Object& schema, const EnumElement& e, TypeAttributes options)
+    so::Object& renderSchemaSpecific(
+        so::Object& schema, const EnumElement& e, TypeAttributes options, GenerationContext& context)
     {
-        options = updateTypeAttributes(e, options);
+        options = updateTypeAttributes(context(e), options);
 
         so::Array enm{};   // schemas typing single value accumulated in `enum`
         so::Array anyOf{}; // anything other schemas
@@ -496,9 +534,9 @@ namespace
                 for (const auto& enumEntry : enums->get()) {
                     assert(enumEntry);
                     if (sizeOf(*enumEntry) == cardinal{ 1 }) // schema types single value
-                        so::emplace_unique(enm, generateJsonValue(*enumEntry));
+                        so::emplace_unique(enm, generateJsonValue(*enumEntry, context));
                     else { // schema MAY type more values
-                        auto s = makeSchema(*enumEntry, inheritFlags(options));
+                        auto s = makeSchema(*enumEntry, inheritFlags(options), context);
                         if (s.data.size() == 1) {
                             const auto& key = s.data.at(0).first;
                             auto* vals = mpark::get_if<so::Array>(&s.data.at(0).second);
@@ -537,7 +575,8 @@ namespace
         return schema;
     }
 
-    so::Object& renderSchemaSpecific(so::Object& schema, const NullElement& e, TypeAttributes options)
+    so::Object& renderSchemaSpecific(
+        so::Object& schema, const NullElement& e, TypeAttributes options, GenerationContext& context)
     {
         addType(schema, "null");
         return schema;
@@ -562,9 +601,9 @@ namespace
     };
 
     template <typename E>
-    so::Object& renderSchemaPrimitive(so::Object& s, const E& e, TypeAttributes options)
+    so::Object& renderSchemaPrimitive(so::Object& s, const E& e, TypeAttributes options, GenerationContext& context)
     {
-        options = updateTypeAttributes(e, options);
+        options = updateTypeAttributes(context(e), options);
 
         if (options.test(FIXED_FLAG)) {
             if (!e.empty()) {
@@ -586,59 +625,67 @@ namespace
         return s;
     }
 
-    so::Object& renderSchemaSpecific(so::Object& s, const MemberElement& e, TypeAttributes options)
+    so::Object& renderSchemaSpecific(
+        so::Object& s, const MemberElement& e, TypeAttributes options, GenerationContext& context)
     {
         return errorByImpossibleSchema(s, e);
     }
 
-    so::Object& renderSchemaSpecific(so::Object& s, const OptionElement& e, TypeAttributes options)
+    so::Object& renderSchemaSpecific(
+        so::Object& s, const OptionElement& e, TypeAttributes options, GenerationContext& context)
     {
         return errorByImpossibleSchema(s, e);
     }
 
-    so::Object& renderSchemaSpecific(so::Object& s, const SelectElement& e, TypeAttributes options)
+    so::Object& renderSchemaSpecific(
+        so::Object& s, const SelectElement& e, TypeAttributes options, GenerationContext& context)
     {
         return errorByImpossibleSchema(s, e);
     }
 
-    so::Object& renderSchemaSpecific(so::Object& s, const StringElement& e, TypeAttributes options)
+    so::Object& renderSchemaSpecific(
+        so::Object& s, const StringElement& e, TypeAttributes options, GenerationContext& context)
     {
-        return renderSchemaPrimitive(s, e, options);
+        return renderSchemaPrimitive(s, e, options, context);
     }
 
-    so::Object& renderSchemaSpecific(so::Object& s, const NumberElement& e, TypeAttributes options)
+    so::Object& renderSchemaSpecific(
+        so::Object& s, const NumberElement& e, TypeAttributes options, GenerationContext& context)
     {
-        return renderSchemaPrimitive(s, e, options);
+        return renderSchemaPrimitive(s, e, options, context);
     }
 
-    so::Object& renderSchemaSpecific(so::Object& s, const BooleanElement& e, TypeAttributes options)
+    so::Object& renderSchemaSpecific(
+        so::Object& s, const BooleanElement& e, TypeAttributes options, GenerationContext& context)
     {
-        return renderSchemaPrimitive(s, e, options);
+        return renderSchemaPrimitive(s, e, options, context);
     }
 
-    so::Object& renderSchemaSpecific(so::Object& s, const ExtendElement& e, TypeAttributes options)
+    so::Object& renderSchemaSpecific(
+        so::Object& s, const ExtendElement& e, TypeAttributes options, GenerationContext& context)
     {
-        auto merged = e.get().merge();
-        renderSchema(s, *merged, options);
+        renderSchema(s, context.merged(e), options, context);
         return s;
     }
 
     struct RenderSchemaVisitor {
         so::Object* schemaPtr;
         TypeAttributes options;
+        GenerationContext* context;
 
         template <typename ElementT>
         void operator()(const ElementT& el)
         {
-            renderSchemaSpecific(*schemaPtr, el, options);
+            renderSchemaSpecific(*schemaPtr, el, options, *context);
         }
     };
 
-    so::Object& renderSchema(so::Object& schema, const IElement& e, TypeAttributes options)
+    so::Object& renderSchema(so::Object& schema, const IElement& e, TypeAttributes options, GenerationContext& context)
     {
         LOG(debug) << "rendering `" << e.element() << "` element to JSON Schema";
+        context.render();
 
-        refract::visit(e, RenderSchemaVisitor{ &schema, options });
+        refract::visit(e, RenderSchemaVisitor{ &schema, options, &context });
         return schema;
     }
 } // namespace
@@ -651,80 +698,83 @@ namespace
         LOG(error) << "skipping invalid property element: " << element.element();
     }
 
-    void renderPropertySpecific(ObjectSchema&, const ArrayElement& element, TypeAttributes)
+    void renderPropertySpecific(ObjectSchema&, const ArrayElement& element, TypeAttributes, GenerationContext&)
     {
         errorButSkipProperty(element);
     }
 
-    void renderPropertySpecific(ObjectSchema&, const BooleanElement& element, TypeAttributes)
+    void renderPropertySpecific(ObjectSchema&, const BooleanElement& element, TypeAttributes, GenerationContext&)
     {
         errorButSkipProperty(element);
     }
 
-    void renderPropertySpecific(ObjectSchema&, const EnumElement& element, TypeAttributes)
+    void renderPropertySpecific(ObjectSchema&, const EnumElement& element, TypeAttributes, GenerationContext&)
     {
         errorButSkipProperty(element);
     }
 
-    void renderPropertySpecific(ObjectSchema&, const NullElement& element, TypeAttributes)
+    void renderPropertySpecific(ObjectSchema&, const NullElement& element, TypeAttributes, GenerationContext&)
     {
         errorButSkipProperty(element);
     }
 
-    void renderPropertySpecific(ObjectSchema&, const NumberElement& element, TypeAttributes)
+    void renderPropertySpecific(ObjectSchema&, const NumberElement& element, TypeAttributes, GenerationContext&)
     {
         errorButSkipProperty(element);
     }
 
-    void renderPropertySpecific(ObjectSchema&, const StringElement& element, TypeAttributes)
+    void renderPropertySpecific(ObjectSchema&, const StringElement& element, TypeAttributes, GenerationContext&)
     {
         errorButSkipProperty(element);
     }
 
-    void renderPropertySpecific(ObjectSchema&, const OptionElement& element, TypeAttributes)
+    void renderPropertySpecific(ObjectSchema&, const OptionElement& element, TypeAttributes, GenerationContext&)
     {
         errorButSkipProperty(element);
     }
 
-    void renderPropertySpecific(ObjectSchema& s, const MemberElement& e, TypeAttributes options)
+    void renderPropertySpecific(
+        ObjectSchema& s, const MemberElement& e, TypeAttributes options, GenerationContext& context)
     {
-        if (hasFixedTypeAttr(e))
+        const auto& memberTraits = context(e);
+
+        if (memberTraits.fixed)
             options.set(FIXED_FLAG);
 
-        options.set(FIXED_TYPE_FLAG, hasFixedTypeTypeAttr(e));
-        options.set(NULLABLE_FLAG, hasNullableTypeAttr(e));
+        options.set(FIXED_TYPE_FLAG, memberTraits.fixedType);
+        options.set(NULLABLE_FLAG, memberTraits.nullable);
 
-        if (hasRequiredTypeAttr(e))
+        if (memberTraits.required)
             options.set(REQUIRED_FLAG);
 
-        if (hasOptionalTypeAttr(e))
+        if (memberTraits.optional)
             options.reset(REQUIRED_FLAG);
 
         const auto k = e.get().key();
         const auto v = e.get().value();
 
         assert(k);
-        if (isVariable(e)) {
+        if (memberTraits.variable) {
 
             if (const auto& extKey = get<const ExtendElement>(k)) {
-                auto mergedKey = extKey->get().merge();
-                auto strKey = get<const StringElement>(mergedKey.get());
+                const auto& mergedKey = context.merged(*extKey);
+                auto strKey = get<const StringElement>(&mergedKey);
 
                 if (!strKey) {
                     LOG(error) << "Merging Member Element key yielded other than String Element: "
-                               << mergedKey->element();
+                               << mergedKey.element();
                     assert(false);
                 }
 
                 emplace_unique(s.patternProperties, //
-                    renderPattern(*strKey, passFlags(options)),
-                    makeSchema(*v, passFlags(options)));
+                    renderPattern(*strKey, passFlags(options), context),
+                    makeSchema(*v, passFlags(options), context));
 
             } else if (const auto& strKey = get<const StringElement>(k)) {
 
                 emplace_unique(s.patternProperties, //
-                    renderPattern(*strKey, passFlags(options)),
-                    makeSchema(*v, passFlags(options)));
+                    renderPattern(*strKey, passFlags(options), context),
+                    makeSchema(*v, passFlags(options), context));
 
             } else {
                 LOG(error) << "Unexpected element type in Member Element key: " << k->element();
@@ -734,27 +784,30 @@ namespace
         } else {
             auto strKey = key(e);
 
-            s.properties.data.emplace_back(strKey, makeSchema(*v, passFlags(options)));
+            s.properties.data.emplace_back(strKey, makeSchema(*v, passFlags(options), context));
 
             if (options.test(REQUIRED_FLAG))
                 s.required.data.emplace_back(so::String{ strKey });
         }
     }
 
-    void renderPropertySpecific(ObjectSchema& s, const HolderElement& e, TypeAttributes options)
+    void renderPropertySpecific(
+        ObjectSchema& s, const HolderElement& e, TypeAttributes options, GenerationContext& context)
     {
         if (!e.empty() && e.get().data())
-            renderProperty(s, *e.get().data(), passFlags(options));
+            renderProperty(s, *e.get().data(), passFlags(options), context);
     }
 
-    void renderPropertySpecific(ObjectSchema& s, const RefElement& e, TypeAttributes options)
+    void renderPropertySpecific(
+        ObjectSchema& s, const RefElement& e, TypeAttributes options, GenerationContext& context)
     {
         if (const IElement* resolved = resolve(e))
-            renderProperty(s, *resolved, passFlags(options));
+            renderProperty(s, *resolved, passFlags(options), context);
         LOG(warning) << "ignoring unresolved reference in json schema backend";
     }
 
-    void renderPropertySpecific(ObjectSchema& s, const SelectElement& e, TypeAttributes options)
+    void renderPropertySpecific(
+        ObjectSchema& s, const SelectElement& e, TypeAttributes options, GenerationContext& context)
     {
         so::Array oneOfs{};
         for (const auto& option : e.get()) {
@@ -772,7 +825,7 @@ namespace
             ObjectSchema optionSchema{};
             for (const auto& optionEntry : option->get()) {
                 assert(optionEntry);
-                renderProperty(optionSchema, *optionEntry, passFlags(options));
+                renderProperty(optionSchema, *optionEntry, passFlags(options), context);
             }
 
             oneOfs.data.emplace_back(materialize(std::move(optionSchema)));
@@ -782,9 +835,10 @@ namespace
         s.allOf.data.emplace_back(std::move(result));
     }
 
-    void renderPropertySpecific(ObjectSchema& s, const ObjectElement& e, TypeAttributes options)
+    void renderPropertySpecific(
+        ObjectSchema& s, const ObjectElement& e, TypeAttributes options, GenerationContext& context)
     {
-        if (hasFixedTypeAttr(e))
+        if (context(e).fixed)
             options.set(FIXED_FLAG);
 
         if (e.empty())
@@ -792,35 +846,37 @@ namespace
         else
             for (const auto& item : e.get()) {
                 assert(item);
-                renderProperty(s, *item, inheritFlags(options));
+                renderProperty(s, *item, inheritFlags(options), context);
             }
     }
 
-    void renderPropertySpecific(ObjectSchema& s, const ExtendElement& e, TypeAttributes options)
+    void renderPropertySpecific(
+        ObjectSchema& s, const ExtendElement& e, TypeAttributes options, GenerationContext& context)
     {
         if (e.empty())
             LOG(warning) << "empty extend element in backend";
 
-        auto merged = e.get().merge();
-        renderProperty(s, *merged, passFlags(options));
+        renderProperty(s, context.merged(e), passFlags(options), context);
     }
 
     struct RenderPropertyVisitor {
         ObjectSchema* schemaPtr;
         TypeAttributes options;
+        GenerationContext* context;
 
         template <typename ElementT>
         void operator()(const ElementT& el)
         {
-            renderPropertySpecific(*schemaPtr, el, options);
+            renderPropertySpecific(*schemaPtr, el, options, *context);
         }
     };
 
-    void renderProperty(ObjectSchema& s, const IElement& e, TypeAttributes options)
+    void renderProperty(ObjectSchema& s, const IElement& e, TypeAttributes options, GenerationContext& context)
     {
         LOG(debug) << "rendering property `" << e.element() << "` as JSON Schema";
+        context.render();
 
-        refract::visit(e, RenderPropertyVisitor{ &s, options });
+        refract::visit(e, RenderPropertyVisitor{ &s, options, &context });
     }
 } // namespace
 
@@ -887,11 +943,24 @@ namespace
 } // namespace
 
 so::Object schema::generateJsonSchema(const IElement& el)
+{
+    ElementTraitsCache traits;
+    return generateJsonSchema(el, traits);
+}
+
+so::Object schema::generateJsonSchema(const IElement& el, ElementTraitsCache& traits)
+{
+    const GenerationLimits limits;
+    GenerationContext context(traits, limits);
+    return generateJsonSchema(el, context);
+}
+
+so::Object schema::generateJsonSchema(const IElement& el, GenerationContext& context)
 {
     so::Object result{};
 
     addSchemaVersion(result);
-    renderSchema(result, el, TypeAttributes{});
+    renderSchema(result, el, TypeAttributes{}, context);
 
     reduce(result);
 
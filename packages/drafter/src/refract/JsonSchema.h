@@ -12,12 +12,28 @@
 #include "../utils/so/Value.h"
 
 #include "ElementIfc.h"
+#include "ElementTraits.h"
+#include "GenerationContext.h"
 
 namespace refract
 {
     namespace schema
     {
         drafter::utils::so::Object generateJsonSchema(const IElement& el);
+
+        ///
+        /// Generate a JSON Schema, consulting and filling given traits cache
+        ///
+        /// @remark see refract::generateJsonValue
+        ///
+        drafter::utils::so::Object generateJsonSchema(const IElement& el, ElementTraitsCache& traits);
+
+        ///
+        /// Generate a JSON Schema as part of given generation
+        ///
+        /// @remark see refract::generateJsonValue
+        ///
+        drafter::utils::so::Object generateJsonSchema(const IElement& el, GenerationContext& context);
     }
 }
 
@@ -13,6 +13,8 @@
 #include "../utils/so/JsonIo.h"
 #include "Element.h"
 #include "ElementUtils.h"
+#include "ElementTraits.h"
+#include "GenerationContext.h"
 #include "Utils.h"
 #include "JsonUtils.h"
 #include <algorithm>
@@ -30,12 +32,12 @@ namespace
     constexpr std::size_t FIXED_FLAG = 0;
     constexpr std::size_t NULLABLE_FLAG = 1;
 
-    TypeAttributes updateTypeAttributes(const IElement& element, TypeAttributes options) noexcept
+    TypeAttributes updateTypeAttributes(const ElementTraits& traits, TypeAttributes options) noexcept
     {
-        if (hasFixedTypeAttr(element))
+        if (traits.fixed)
             options.set(FIXED_FLAG);
 
-        if (hasNullableTypeAttr(element))
+        if (traits.nullable)
             options.set(NULLABLE_FLAG);
 
         return options;
@@ -52,10 +54,10 @@ namespace
         return options;
     }
 
-    TypeAttributes inheritOrPassFlags(TypeAttributes options, const IElement& element)
+    TypeAttributes inheritOrPassFlags(TypeAttributes options, const IElement& element, GenerationContext& context)
     {
         auto result = inheritFlags(options);
-        if (inheritsFixed(element)) {
+        if (context(element).inheritsFixed) {
             LOG(debug) << "\"" << element.element() << "\"-Element inherits fixed";
             return result;
         }
@@ -65,50 +67,76 @@ namespace
 
 namespace
 {
-    void renderPropertySpecific(so::Object& obj, const ArrayElement& element, TypeAttributes options);
-    void renderPropertySpecific(so::Object& obj, const BooleanElement& element, TypeAttributes options);
-    void renderPropertySpecific(so::Object& obj, const EnumElement& element, TypeAttributes options);
-    void renderPropertySpecific(so::Object& obj, const ExtendElement& element, TypeAttributes options);
-    void renderPropertySpecific(so::Object& obj, const HolderElement& element, TypeAttributes options);
-    void renderPropertySpecific(so::Object& obj, const MemberElement& element, TypeAttributes options);
-    void renderPropertySpecific(so::Object& obj, const NullElement& element, TypeAttributes options);
-    void renderPropertySpecific(so::Object& obj, const NumberElement& element, TypeAttributes options);
-    void renderPropertySpecific(so::Object& obj, const ObjectElement& element, TypeAttributes options);
-    void renderPropertySpecific(so::Object& obj, const OptionElement& element, TypeAttributes options);
-    void renderPropertySpecific(so::Object& obj, const RefElement& element, TypeAttributes options);
-    void renderPropertySpecific(so::Object& obj, const SelectElement& element, TypeAttributes options);
-    void renderPropertySpecific(so::Object& obj, const StringElement& element, TypeAttributes options);
-    void renderProperty(so::Object& obj, const IElement& element, TypeAttributes options);
-
-    so::Value renderValueSpecific(const ArrayElement& element, TypeAttributes options);
-    so::Value renderValueSpecific(const BooleanElement& element, TypeAttributes options);
-    so::Value renderValueSpecific(const EnumElement& element, TypeAttributes options);
-    so::Value renderValueSpecific(const ExtendElement& element, TypeAttributes options);
-    so::Value renderValueSpecific(const HolderElement& element, TypeAttributes options);
-    so::Value renderValueSpecific(const MemberElement& element, TypeAttributes options);
-    so::Value renderValueSpecific(const NullElement& element, TypeAttributes options);
-    so::Value renderValueSpecific(const NumberElement& element, TypeAttributes options);
-    so::Value renderValueSpecific(const ObjectElement& element, TypeAttributes options);
-    so::Value renderValueSpecific(const OptionElement& element, TypeAttributes options);
-    so::Value renderValueSpecific(const RefElement& element, TypeAttributes options);
-    so::Value renderValueSpecific(const SelectElement& element, TypeAttributes options);
-    so::Value renderValueSpecific(const StringElement& element, TypeAttributes options);
-    so::Value renderValue(const IElement& element, TypeAttributes options);
-
-    void renderItemSpecific(so::Array& array, const ArrayElement& element, TypeAttributes options);
-    void renderItemSpecific(so::Array& array, const BooleanElement& element, TypeAttributes options);
-    void renderItemSpecific(so::Array& array, const EnumElement& element, TypeAttributes options);
-    void renderItemSpecific(so::Array& array, const ExtendElement& element, TypeAttributes options);
-    void renderItemSpecific(so::Array& array, const HolderElement& element, TypeAttributes options);
-    void renderItemSpecific(so::Array& array, const MemberElement& element, TypeAttributes options);
-    void renderItemSpecific(so::Array& array, const NullElement& element, TypeAttributes options);
-    void renderItemSpecific(so::Array& array, const NumberElement& element, TypeAttributes options);
-    void renderItemSpecific(so::Array& array, const ObjectElement& element, TypeAttributes options);
-    void renderItemSpecific(so::Array& array, const OptionElement& element, TypeAttributes options);
-    void renderItemSpecific(so::Array& array, const RefElement& element, TypeAttributes options);
-    void renderItemSpecific(so::Array& array, const SelectElement& element, TypeAttributes options);
-    void renderItemSpecific(so::Array& array, const StringElement& element, TypeAttributes options);
-    void renderItem(so::Array& array, const IElement& element, TypeAttributes options);
+    void renderPropertySpecific(
+        so::Object& obj, const ArrayElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        so::Object& obj, const BooleanElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        so::Object& obj, const EnumElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        so::Object& obj, const ExtendElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        so::Object& obj, const HolderElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        so::Object& obj, const MemberElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        so::Object& obj, const NullElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        so::Object& obj, const NumberElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        so::Object& obj, const ObjectElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        so::Object& obj, const OptionElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        so::Object& obj, const RefElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        so::Object& obj, const SelectElement& element, TypeAttributes options, GenerationContext& context);
+    void renderPropertySpecific(
+        so::Object& obj, const StringElement& element, TypeAttributes options, GenerationContext& context);
+    void renderProperty(so::Object& obj, const IElement& element, TypeAttributes options, GenerationContext& context);
+
+    so::Value renderValueSpecific(const ArrayElement& element, TypeAttributes options, GenerationContext& context);
+    so::Value renderValueSpecific(const BooleanElement& element, TypeAttributes options, GenerationContext& context);
+    so::Value renderValueSpecific(const EnumElement& element, TypeAttributes options, GenerationContext& context);
+    so::Value renderValueSpecific(const ExtendElement& element, TypeAttributes options, GenerationContext& context);
+    so::Value renderValueSpecific(const HolderElement& element, TypeAttributes options, GenerationContext& context);
+    so::Value renderValueSpecific(const MemberElement& element, TypeAttributes options, GenerationContext& context);
+    so::Value renderValueSpecific(const NullElement& element, TypeAttributes options, GenerationContext& context);
+    so::Value renderValueSpecific(const NumberElement& element, TypeAttributes options, GenerationContext& context);
+    so::Value renderValueSpecific(const ObjectElement& element, TypeAttributes options, GenerationContext& context);
+    so::Value renderValueSpecific(const OptionElement& element, TypeAttributes options, GenerationContext& context);
+    so::Value renderValueSpecific(const RefElement& element, TypeAttributes options, GenerationContext& context);
+    so::Value renderValueSpecific(const SelectElement& element, TypeAttributes options, GenerationContext& context);
+    so::Value renderValueSpecific(const StringElement& element, TypeAttributes options, GenerationContext& context);
+    so::Value renderValue(const IElement& element, TypeAttributes options, GenerationContext& context);
+
+    void renderItemSpecific(
+        so::Array& array, const ArrayElement& element, TypeAttributes options, GenerationContext& context);
+    void renderItemSpecific(
+        so::Array& array, const BooleanElement& element, TypeAttributes options, GenerationContext& context);
+    void renderItemSpecific(
+        so::Array& array, const EnumElement& element, TypeAttributes options, GenerationContext& context);
+    void renderItemSpecific(
+        so::Array& array, const ExtendElement& element, TypeAttributes options, GenerationContext& context);
+    void renderItemSpecific(
+        so::Array& array, const HolderElement& element, TypeAttributes options, GenerationContext& context);
+    void renderItemSpecific(
+        so::Array& array, const MemberElement& element, TypeAttributes options, GenerationContext& context);
+    void renderItemSpecific(
+        so::Array& array, const NullElement& element, TypeAttributes options, GenerationContext& context);
+    void renderItemSpecific(
+        so::Array& array, const NumberElement& element, TypeAttributes options, GenerationContext& context);
+    void renderItemSpecific(
+        so::Array& array, const ObjectElement& element, TypeAttributes options, GenerationContext& context);
+    void renderItemSpecific(
+        so::Array& array, const OptionElement& element, TypeAttributes options, GenerationContext& context);
+    void renderItemSpecific(
+        so::Array& array, const RefElement& element, TypeAttributes options, GenerationContext& context);
+    void renderItemSpecific(
+        so::Array& array, const SelectElement& element, TypeAttributes options, GenerationContext& context);
+    void renderItemSpecific(
+        so::Array& array, const StringElement& element, TypeAttributes options, GenerationContext& context);
+    void renderItem(so::Array& array, const IElement& element, TypeAttributes options, GenerationContext& context);
 }
 
 namespace
@@ -125,13 +153,16 @@ namespace
     /// @return         pair of [<whether successful>, <rendered so value>]
     ///
     template <typename Element>
-    std::pair<bool, so::Value> renderSampleOrDefaultOrNull(const Element& element, TypeAttributes options)
+    std::pair<bool, so::Value> renderSampleOrDefaultOrNull(
+        const Element& element, TypeAttributes options, GenerationContext& context)
     {
-        if (const auto& sampleValue = findFirstSample(element))
-            return { true, renderValue(*sampleValue, options) };
+        const auto& elementTraits = context(element);
 
-        if (const auto& defaultValue = findDefault(element))
-            return { true, renderValue(*defaultValue, options) };
+        if (const auto& sampleValue = elementTraits.firstSample)
+            return { true, renderValue(*sampleValue, options, context) };
+
+        if (const auto& defaultValue = elementTraits.deflt)
+            return { true, renderValue(*defaultValue, options, context) };
 
         if (options.test(NULLABLE_FLAG))
             return { true, so::Null{} };
@@ -150,12 +181,12 @@ namespace
     }
 
     template <typename Element>
-    so::Value renderValuePrimitive(const Element& element, TypeAttributes options)
+    so::Value renderValuePrimitive(const Element& element, TypeAttributes options, GenerationContext& context)
     {
-        options = updateTypeAttributes(element, options);
+        options = updateTypeAttributes(context(element), options);
 
         if (element.empty()) {
-            auto alt = renderSampleOrDefaultOrNull(element, passFlags(options));
+            auto alt = renderSampleOrDefaultOrNull(element, passFlags(options), context);
             if (alt.first)
                 return std::move(alt.second);
 
@@ -166,86 +197,86 @@ namespace
         return utils::instantiate(element.get());
     }
 
-    so::Value renderValueSpecific(const StringElement& element, TypeAttributes options)
+    so::Value renderValueSpecific(const StringElement& element, TypeAttributes options, GenerationContext& context)
     {
-        return renderValuePrimitive(element, passFlags(options));
+        return renderValuePrimitive(element, passFlags(options), context);
     }
 
-    so::Value renderValueSpecific(const NumberElement& element, TypeAttributes options)
+    so::Value renderValueSpecific(const NumberElement& element, TypeAttributes options, GenerationContext& context)
     {
-        return renderValuePrimitive(element, passFlags(options));
+        return renderValuePrimitive(element, passFlags(options), context);
     }
 
-    so::Value renderValueSpecific(const BooleanElement& element, TypeAttributes options)
+    so::Value renderValueSpecific(const BooleanElement& element, TypeAttributes options, GenerationContext& context)
     {
-        return renderValuePrimitive(element, passFlags(options));
+        return renderValuePrimitive(element, passFlags(options), context);
     }
 
-    so::Value renderValueSpecific(const MemberElement& element, TypeAttributes options)
+    so::Value renderValueSpecific(const MemberElement& element, TypeAttributes options, GenerationContext& context)
     {
         return errorByNull(element);
     }
 
-    so::Value renderValueSpecific(const OptionElement& element, TypeAttributes options)
+    so::Value renderValueSpecific(const OptionElement& element, TypeAttributes options, GenerationContext& context)
     {
         return errorByNull(element);
     }
 
-    so::Value renderValueSpecific(const SelectElement& element, TypeAttributes options)
+    so::Value renderValueSpecific(const SelectElement& element, TypeAttributes options, GenerationContext& context)
     {
         return errorByNull(element);
     }
 
-    so::Value renderValueSpecific(const HolderElement& element, TypeAttributes options)
+    so::Value renderValueSpecific(const HolderElement& element, TypeAttributes options, GenerationContext& context)
     {
         if (!element.empty() && element.get().data())
-            return renderValue(*element.get().data(), passFlags(options));
+            return renderValue(*element.get().data(), passFlags(options), context);
         return so::Null{};
     }
 
-    so::Value renderValueSpecific(const ObjectElement& element, TypeAttributes options)
+    so::Value renderValueSpecific(const ObjectElement& element, TypeAttributes options, GenerationContext& context)
     {
         so::Object result{};
 
-        options = updateTypeAttributes(element, options);
+        options = updateTypeAttributes(context(element), options);
 
         if (element.empty()) {
-            auto alt = renderSampleOrDefaultOrNull(element, passFlags(options));
+            auto alt = renderSampleOrDefaultOrNull(element, passFlags(options), context);
             if (alt.first)
                 return std::move(alt.second);
         } else
             for (const auto& item : element.get()) {
                 assert(item);
-                renderProperty(result, *item, inheritOrPassFlags(options, *item));
+                renderProperty(result, *item, inheritOrPassFlags(options, *item, context), context);
             }
 
         return result;
     }
 
-    so::Value renderValueSpecific(const ArrayElement& element, TypeAttributes options)
+    so::Value renderValueSpecific(const ArrayElement& element, TypeAttributes options, GenerationContext& context)
     {
-        options = updateTypeAttributes(element, options);
+        options = updateTypeAttributes(context(element), options);
 
         so::Array result{};
         if (element.empty()) {
-            auto alt = renderSampleOrDefaultOrNull(element, passFlags(options));
+            auto alt = renderSampleOrDefaultOrNull(element, passFlags(options), context);
             if (alt.first)
                 return std::move(alt.second);
         } else
             for (const auto& entry : element.get()) {
                 assert(entry);
-                renderItem(result, *entry, inheritOrPassFlags(options, *entry));
+                renderItem(result, *entry, inheritOrPassFlags(options, *entry, context), context);
             }
 
         return so::Value{ result };
     }
 
-    so::Value renderValueSpecific(const EnumElement& element, TypeAttributes options)
+    so::Value renderValueSpecific(const EnumElement& element, TypeAttributes options, GenerationContext& context)
     {
-        options = updateTypeAttributes(element, options);
+        options = updateTypeAttributes(context(element), options);
 
         if (element.empty()) {
-            auto alt = renderSampleOrDefaultOrNull(element, passFlags(options));
+            auto alt = renderSampleOrDefaultOrNull(element, passFlags(options), context);
             if (alt.first)
                 return std::move(alt.second);
 
@@ -257,7 +288,7 @@ namespace
                 if (!enums->empty())
                     for (const auto& enumEntry : enums->get()) {
                         assert(enumEntry);
-                        return renderValue(*enumEntry, passFlags(options));
+                        return renderValue(*enumEntry, passFlags(options), context);
                     }
             }
 
@@ -266,43 +297,43 @@ namespace
         }
 
         assert(element.get().value());
-        return renderValue(*element.get().value(), inheritFlags(options));
+        return renderValue(*element.get().value(), inheritFlags(options), context);
     }
 
-    so::Value renderValueSpecific(const NullElement& element, TypeAttributes options)
+    so::Value renderValueSpecific(const NullElement& element, TypeAttributes options, GenerationContext& context)
     {
         return so::Null{};
     }
 
-    so::Value renderValueSpecific(const ExtendElement& element, TypeAttributes options)
+    so::Value renderValueSpecific(const ExtendElement& element, TypeAttributes options, GenerationContext& context)
     {
-        auto merged = element.get().merge();
-        assert(merged);
-        return renderValue(*merged, options);
+        return renderValue(context.merged(element), options, context);
     }
 
-    so::Value renderValueSpecific(const RefElement& element, TypeAttributes options)
+    so::Value renderValueSpecific(const RefElement& element, TypeAttributes options, GenerationContext& context)
     {
         if (const IElement* resolved = resolve(element))
-            return renderValue(*resolved, passFlags(options));
+            return renderValue(*resolved, passFlags(options), context);
         LOG(warning) << "ignoring unresolved reference in json value backend";
         return so::Null{};
     }
 
     struct RenderValueVisitor {
         TypeAttributes options;
+        GenerationContext* context;
 
         template <typename ElementT>
         so::Value operator()(const ElementT& el) const
         {
-            return renderValueSpecific(el, options);
+            return renderValueSpecific(el, options, *context);
         }
     };
 
-    so::Value renderValue(const IElement& element, TypeAttributes options)
+    so::Value renderValue(const IElement& element, TypeAttributes options, GenerationContext& context)
     {
         LOG(debug) << "rendering `" << element.element() << "` element to JSON Value";
-        return refract::visit(element, RenderValueVisitor{ options });
+        context.render();
+        return refract::visit(element, RenderValueVisitor{ options, &context });
     }
 
 } // namespace
@@ -315,60 +346,71 @@ namespace
         LOG(error) << "skipping invalid property element: " << element.element();
     }
 
-    void renderPropertySpecific(so::Object& obj, const ArrayElement& element, TypeAttributes options)
+    void renderPropertySpecific(
+        so::Object& obj, const ArrayElement& element, TypeAttributes options, GenerationContext& context)
     {
         errorButSkipProperty(element);
     }
 
-    void renderPropertySpecific(so::Object& obj, const BooleanElement& element, TypeAttributes options)
+    void renderPropertySpecific(
+        so::Object& obj, const BooleanElement& element, TypeAttributes options, GenerationContext& context)
     {
         errorButSkipProperty(element);
     }
 
-    void renderPropertySpecific(so::Object& obj, const EnumElement& element, TypeAttributes options)
+    void renderPropertySpecific(
+        so::Object& obj, const EnumElement& element, TypeAttributes options, GenerationContext& context)
     {
         errorButSkipProperty(element);
     }
 
-    void renderPropertySpecific(so::Object& obj, const NullElement& element, TypeAttributes options)
+    void renderPropertySpecific(
+        so::Object& obj, const NullElement& element, TypeAttributes options, GenerationContext& context)
     {
         errorButSkipProperty(element);
     }
 
-    void renderPropertySpecific(so::Object& obj, const NumberElement& element, TypeAttributes options)
+    void renderPropertySpecific(
+        so::Object& obj, const NumberElement& element, TypeAttributes options, GenerationContext& context)
     {
         errorButSkipProperty(element);
     }
 
-    void renderPropertySpecific(so::Object& obj, const StringElement& element, TypeAttributes options)
+    void renderPropertySpecific(
+        so::Object& obj, const StringElement& element, TypeAttributes options, GenerationContext& context)
     {
         errorButSkipProperty(element);
     }
 
-    void renderPropertySpecific(so::Object& obj, const OptionElement& element, TypeAttributes options)
+    void renderPropertySpecific(
+        so::Object& obj, const OptionElement& element, TypeAttributes options, GenerationContext& context)
     {
         errorButSkipProperty(element);
     }
 
-    void renderPropertySpecific(so::Object& obj, const HolderElement& element, TypeAttributes options)
+    void renderPropertySpecific(
+        so::Object& obj, const HolderElement& element, TypeAttributes options, GenerationContext& context)
     {
         if (!element.empty() && element.get().data())
-            renderProperty(obj, *element.get().data(), options);
+            renderProperty(obj, *element.get().data(), options, context);
         else
             errorButSkipProperty(element);
     }
 
-    void renderPropertySpecific(so::Object& obj, const MemberElement& element, TypeAttributes options)
+    void renderPropertySpecific(
+        so::Object& obj, const MemberElement& element, TypeAttributes options, GenerationContext& context)
     {
-        options = updateTypeAttributes(element, options);
+        const auto& memberTraits = context(element);
+
+        options = updateTypeAttributes(memberTraits, options);
 
         const auto* elementKey = element.get().key();
         const auto* elementValue = element.get().value();
 
         assert(elementKey);
 
-        if (hasOptionalTypeAttr(element))
-            if (!definesValue(*elementValue)) {
+        if (memberTraits.optional)
+            if (!context(*elementValue).definesValue) {
                 LOG(debug) << "omitting optional property while rendering value";
                 return;
             }
@@ -376,18 +418,20 @@ namespace
         auto strKey = renderKey(*elementKey);
 
         if (!strKey.empty())
-            emplace_unique(obj, strKey, renderValue(*elementValue, passFlags(options)));
+            emplace_unique(obj, strKey, renderValue(*elementValue, passFlags(options), context));
     }
 
-    void renderPropertySpecific(so::Object& obj, const RefElement& element, TypeAttributes options)
+    void renderPropertySpecific(
+        so::Object& obj, const RefElement& element, TypeAttributes options, GenerationContext& context)
     {
         if (const IElement* resolved = resolve(element))
-            renderProperty(obj, *resolved, passFlags(options));
+            renderProperty(obj, *resolved, passFlags(options), context);
         else
             LOG(warning) << "ignoring unresolved reference in json value backend";
     }
 
-    void renderPropertySpecific(so::Object& value, const SelectElement& element, TypeAttributes options)
+    void renderPropertySpecific(
+        so::Object& value, const SelectElement& element, TypeAttributes options, GenerationContext& context)
     {
         so::Array oneOfs{};
         for (const auto& option : element.get()) {
@@ -404,7 +448,7 @@ namespace
 
             for (const auto& optionEntry : option->get()) {
                 assert(optionEntry);
-                renderProperty(value, *optionEntry, passFlags(options));
+                renderProperty(value, *optionEntry, passFlags(options), context);
             }
 
             return;
@@ -413,40 +457,42 @@ namespace
         LOG(warning) << "no non-empty OptionElement in SelectElement; skipping property";
     }
 
-    void renderPropertySpecific(so::Object& value, const ObjectElement& element, TypeAttributes options)
+    void renderPropertySpecific(
+        so::Object& value, const ObjectElement& element, TypeAttributes options, GenerationContext& context)
     {
         // OPTIM @tjanc@ avoid temporary container
-        so::Value mixinValue = renderValueSpecific(element, passFlags(options));
+        so::Value mixinValue = renderValueSpecific(element, passFlags(options), context);
         if (so::Object* mixinValueObject = mpark::get_if<so::Object>(&mixinValue))
             for (auto& property : mixinValueObject->data)
                 emplace_unique(value, std::move(property));
     }
 
-    void renderPropertySpecific(so::Object& value, const ExtendElement& element, TypeAttributes options)
+    void renderPropertySpecific(
+        so::Object& value, const ExtendElement& element, TypeAttributes options, GenerationContext& context)
     {
         if (element.empty())
             LOG(warning) << "empty extend element in backend";
 
-        auto merged = element.get().merge();
-        assert(merged);
-        renderProperty(value, *merged, passFlags(options));
+        renderProperty(value, context.merged(element), passFlags(options), context);
     }
 
     struct RenderPropertyVisitor {
         so::Object* objPtr;
         TypeAttributes options;
+        GenerationContext* context;
 
         template <typename ElementT>
         void operator()(const ElementT& el)
         {
-            renderPropertySpecific(*objPtr, el, options);
+            renderPropertySpecific(*objPtr, el, options, *context);
         }
     };
 
-    void renderProperty(so::Object& value, const IElement& element, TypeAttributes options)
+    void renderProperty(so::Object& value, const IElement& element, TypeAttributes options, GenerationContext& context)
     {
         LOG(debug) << "rendering property `" << element.element() << "` as JSON Value";
-        refract::visit(element, RenderPropertyVisitor{ &value, options });
+        context.render();
+        refract::visit(element, RenderPropertyVisitor{ &value, options, &context });
     }
 
 }
@@ -460,108 +506,140 @@ namespace
     }
 
     template <typename Element>
-    void renderItemPrimitive(so::Array& array, const Element& element, TypeAttributes options)
+    void renderItemPrimitive(
+        so::Array& array, const Element& element, TypeAttributes options, GenerationContext& context)
     {
-        options = updateTypeAttributes(element, options);
+        const auto& elementTraits = context(element);
+
+        options = updateTypeAttributes(elementTraits, options);
 
-        if ((options.test(FIXED_FLAG) || definesValue(element)))
-            array.data.emplace_back(renderValueSpecific(element, inheritOrPassFlags(options, element)));
+        if ((options.test(FIXED_FLAG) || elementTraits.definesValue))
+            array.data.emplace_back(
+                renderValueSpecific(element, inheritOrPassFlags(options, element, context), context));
         else
             LOG(debug) << "skipping empty non-fixed primitive element in ArrayElement";
     }
 
-    void renderItemSpecific(so::Array& array, const ArrayElement& element, TypeAttributes options)
+    void renderItemSpecific(
+        so::Array& array, const ArrayElement& element, TypeAttributes options, GenerationContext& context)
     {
-        array.data.emplace_back(renderValue(element, inheritOrPassFlags(options, element)));
+        array.data.emplace_back(renderValue(element, inheritOrPassFlags(options, element, context), context));
     }
 
-    void renderItemSpecific(so::Array& array, const EnumElement& element, TypeAttributes options)
+    void renderItemSpecific(
+        so::Array& array, const EnumElement& element, TypeAttributes options, GenerationContext& context)
     {
-        array.data.emplace_back(renderValue(element, inheritOrPassFlags(options, element)));
+        array.data.emplace_back(renderValue(element, inheritOrPassFlags(options, element, context), context));
     }
 
-    void renderItemSpecific(so::Array& array, const ExtendElement& element, TypeAttributes options)
+    void renderItemSpecific(
+        so::Array& array, const ExtendElement& element, TypeAttributes options, GenerationContext& context)
     {
-        array.data.emplace_back(renderValueSpecific(element, inheritOrPassFlags(options, element)));
+        array.data.emplace_back(renderValueSpecific(element, inheritOrPassFlags(options, element, context), context));
     }
 
-    void renderItemSpecific(so::Array& array, const NullElement& element, TypeAttributes options)
+    void renderItemSpecific(
+        so::Array& array, const NullElement& element, TypeAttributes options, GenerationContext& context)
     {
-        array.data.emplace_back(renderValueSpecific(element, inheritOrPassFlags(options, element)));
+        array.data.emplace_back(renderValueSpecific(element, inheritOrPassFlags(options, element, context), context));
     }
 
-    void renderItemSpecific(so::Array& array, const ObjectElement& element, TypeAttributes options)
+    void renderItemSpecific(
+        so::Array& array, const ObjectElement& element, TypeAttributes options, GenerationContext& context)
     {
-        array.data.emplace_back(renderValueSpecific(element, inheritOrPassFlags(options, element)));
+        array.data.emplace_back(renderValueSpecific(element, inheritOrPassFlags(options, element, context), context));
     }
 
-    void renderItemSpecific(so::Array& array, const HolderElement& element, TypeAttributes options)
+    void renderItemSpecific(
+        so::Array& array, const HolderElement& element, TypeAttributes options, GenerationContext& context)
     {
-        array.data.emplace_back(renderValueSpecific(element, inheritOrPassFlags(options, element)));
+        array.data.emplace_back(renderValueSpecific(element, inheritOrPassFlags(options, element, context), context));
     };
 
-    void renderItemSpecific(so::Array& array, const MemberElement& element, TypeAttributes options)
+    void renderItemSpecific(
+        so::Array& array, const MemberElement& element, TypeAttributes options, GenerationContext& context)
     {
         errorButSkipItem(element);
     };
 
-    void renderItemSpecific(so::Array& array, const OptionElement& element, TypeAttributes options)
+    void renderItemSpecific(
+        so::Array& array, const OptionElement& element, TypeAttributes options, GenerationContext& context)
     {
         errorButSkipItem(element);
     };
 
-    void renderItemSpecific(so::Array& array, const SelectElement& element, TypeAttributes options)
+    void renderItemSpecific(
+        so::Array& array, const SelectElement& element, TypeAttributes options, GenerationContext& context)
     {
         errorButSkipItem(element);
     };
 
-    void renderItemSpecific(so::Array& array, const RefElement& element, TypeAttributes options)
+    void renderItemSpecific(
+        so::Array& array, const RefElement& element, TypeAttributes options, GenerationContext& context)
     {
         const IElement* resolved = resolve(element);
         if (!resolved) {
             LOG(warning) << "ignoring unresolved reference in json value backend";
         } else if (const auto& mixin = get<const ArrayElement>(resolved)) {
             // OPTIM @tjanc@ avoid temporary container
-            so::Value mixinValue = renderValueSpecific(*mixin, passFlags(options));
+            so::Value mixinValue = renderValueSpecific(*mixin, passFlags(options), context);
             if (const so::Array* mixinValueArray = mpark::get_if<so::Array>(&mixinValue))
                 std::move(mixinValueArray->data.begin(), mixinValueArray->data.end(), std::back_inserter(array.data));
         }
     }
 
-    void renderItemSpecific(so::Array& array, const NumberElement& element, TypeAttributes options)
+    void renderItemSpecific(
+        so::Array& array, const NumberElement& element, TypeAttributes options, GenerationContext& context)
     {
-        renderItemPrimitive(array, element, options);
+        renderItemPrimitive(array, element, options, context);
     }
 
-    void renderItemSpecific(so::Array& array, const StringElement& element, TypeAttributes options)
+    void renderItemSpecific(
+        so::Array& array, const StringElement& element, TypeAttributes options, GenerationContext& context)
     {
-        renderItemPrimitive(array, element, options);
+        renderItemPrimitive(array, element, options, context);
     }
 
-    void renderItemSpecific(so::Array& array, const BooleanElement& element, TypeAttributes options)
+    void renderItemSpecific(
+        so::Array& array, const BooleanElement& element, TypeAttributes options, GenerationContext& context)
     {
-        renderItemPrimitive(array, element, options);
+        renderItemPrimitive(array, element, options, context);
     }
 
     struct RenderItemVisitor {
         so::Array* aPtr;
         TypeAttributes options;
+        GenerationContext* context;
 
         template <typename ElementT>
         void operator()(const ElementT& el)
         {
-            renderItemSpecific(*aPtr, el, options);
+            renderItemSpecific(*aPtr, el, options, *context);
         }
     };
 
-    void renderItem(so::Array& array, const IElement& element, TypeAttributes options)
+    void renderItem(so::Array& array, const IElement& element, TypeAttributes options, GenerationContext& context)
     {
         LOG(debug) << "rendering item `" << element.element() << "` element as JSON Value";
-        refract::visit(element, RenderItemVisitor{ &array, options });
+        context.render();
+        refract::visit(element, RenderItemVisitor{ &array, options, &context });
     }
 } // namespace
 
 so::Value refract::generateJsonValue(const IElement& el)
 {
-    return renderValue(el, TypeAttributes{});
+    ElementTraitsCache traits;
+    return generateJsonValue(el, traits);
+}
+
+so::Value refract::generateJsonValue(const IElement& el, ElementTraitsCache& traits)
+{
+    const GenerationLimits limits;
+    GenerationContext context(traits, limits);
+    return generateJsonValue(el, context);
+}
+
+so::Value refract::generateJsonValue(const IElement& el, GenerationContext& context)
+{
+    return renderValue(el, TypeAttributes{}, context);
 }
@@ -12,10 +12,28 @@
 #include "../utils/so/Value.h"
 
 #include "ElementIfc.h"
+#include "ElementTraits.h"
+#include "GenerationContext.h"
 
 namespace refract
 {
     drafter::utils::so::Value generateJsonValue(const IElement& el);
+
+    ///
+    /// Generate a JSON Value, consulting and filling given traits cache
+    ///
+    /// @remark share the cache with generateJsonSchema over the same
+    ///     expanded tree to analyse each Element once
+    ///
+    drafter::utils::so::Value generateJsonValue(const IElement& el, ElementTraitsCache& traits);
+
+    ///
+    /// Generate a JSON Value as part of given generation
+    ///
+    /// @remark throws snowcrash::Error of snowcrash::LimitError code
+    ///     once the generation exceeds its limits
+    ///
+    drafter::utils::so::Value generateJsonValue(const IElement& el, GenerationContext& context);
 } // namespace refract
 
 #endif
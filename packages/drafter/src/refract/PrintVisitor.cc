@@ -8,6 +8,7 @@
 
 #include "PrintVisitor.h"
 
+#include <atomic>
 #include <cassert>
 #include <fstream>
 #include <iostream>
@@ -220,11 +221,12 @@ namespace refract
 
     int log_to_files(const IElement& e, const std::string& name /*= "print"*/)
     {
-        static int i = 0;
+        static std::atomic<int> counter{ 0 };
+        const int i = counter++;
         std::ofstream out(std::to_string(i) + "-" + name + ".log");
         PrintVisitor printer(0, out);
         Visit(printer, e);
-        return i++;
+        return i;
     }
 
 }; // namespace refract
@@ -37,7 +37,7 @@ const IElement* refract::FindRootAncestor(const std::string& name, const Registr
 {
     const IElement* parent = registry.find(name);
 
-    while (parent && !isReserved(parent->element())) {
+    while (parent && !parent->reserved()) {
         const IElement* next = registry.find(parent->element());
 
         if (!next || (next == parent)) {
@@ -0,0 +1,610 @@
+//
+//  refract/SerializeCbor.cc
+//  librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "SerializeCbor.h"
+
+#include "../utils/log/Trivial.h"
+#include "Element.h"
+#include "ElementUtils.h"
+#include "Exception.h"
+
+#include <cassert>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+using namespace refract;
+using namespace serialize;
+using namespace drafter::utils::log;
+
+namespace
+{
+    constexpr std::uint64_t FormatVersion = 1;
+
+    // CBOR major types
+    constexpr unsigned UnsignedMajor = 0;
+    constexpr unsigned TextMajor = 3;
+    constexpr unsigned ArrayMajor = 4;
+    constexpr unsigned MapMajor = 5;
+    constexpr unsigned TagMajor = 6;
+    constexpr unsigned SimpleMajor = 7;
+
+    // CBOR simple values
+    constexpr std::uint64_t FalseValue = 20;
+    constexpr std::uint64_t TrueValue = 21;
+    constexpr std::uint64_t NullValue = 22;
+    constexpr std::uint64_t UndefinedValue = 23;
+
+    // RFC 8949, 3.4.6 - Self-Described CBOR
+    constexpr std::uint64_t SelfDescribeTag = 55799;
+
+    constexpr std::uint64_t ElementArity = 5;
+
+    enum Kind : std::uint64_t
+    {
+        NullKind = 0,
+        StringKind,
+        NumberKind,
+        BooleanKind,
+        ArrayKind,
+        ObjectKind,
+        MemberKind,
+        EnumKind,
+        SelectKind,
+        OptionKind,
+        ExtendKind,
+        RefKind,
+        HolderKind
+    };
+} // namespace
+
+namespace
+{
+    class Encoder
+    {
+        std::string out_;
+        std::unordered_map<std::string, std::uint64_t> interned_;
+        const bool renderSourceMaps_;
+
+    public:
+        explicit Encoder(bool renderSourceMaps) : renderSourceMaps_(renderSourceMaps) {}
+
+        std::string release()
+        {
+            return std::move(out_);
+        }
+
+        void head(unsigned major, std::uint64_t value)
+        {
+            const char m = static_cast<char>(major << 5);
+
+            if (value < 24) {
+                out_ += static_cast<char>(m | value);
+                return;
+            }
+
+            int bytes = 8;
+            char info = 27;
+            if (value <= 0xff) {
+                bytes = 1;
+                info = 24;
+            } else if (value <= 0xffff) {
+                bytes = 2;
+                info = 25;
+            } else if (value <= 0xffffffff) {
+                bytes = 4;
+                info = 26;
+            }
+
+            out_ += static_cast<char>(m | info);
+            for (int i = bytes - 1; i >= 0; --i)
+                out_ += static_cast<char>((value >> (8 * i)) & 0xff);
+        }
+
+        void simple(std::uint64_t value)
+        {
+            head(SimpleMajor, value);
+        }
+
+        void text(const std::string& s)
+        {
+            head(TextMajor, s.size());
+            out_ += s;
+        }
+
+        void name(const std::string& s)
+        {
+            auto it = interned_.find(s);
+            if (it != interned_.end()) {
+                head(UnsignedMajor, it->second);
+                return;
+            }
+
+            const std::uint64_t index = interned_.size();
+            interned_.emplace(s, index);
+            text(s);
+        }
+
+        void info(const InfoElements& info, bool renderSourceMaps)
+        {
+            std::uint64_t size = 0;
+            for (const auto& entry : info)
+                if (renderSourceMaps || entry.first != "sourceMap")
+                    ++size;
+
+            head(MapMajor, size);
+            for (const auto& entry : info) {
+                assert(entry.second);
+                if (renderSourceMaps || entry.first != "sourceMap") {
+                    name(entry.first);
+                    element(*entry.second);
+                }
+            }
+        }
+
+        template <typename ContainerT>
+        void list(const ContainerT& c)
+        {
+            head(ArrayMajor, c.size());
+            for (const auto& entry : c) {
+                assert(entry);
+                element(*entry);
+            }
+        }
+
+        void content(const dsd::Null&)
+        {
+            simple(NullValue);
+        }
+
+        void content(const dsd::String& value)
+        {
+            text(value.get());
+        }
+
+        void content(const dsd::Number& value)
+        {
+            text(value.get());
+        }
+
+        void content(const dsd::Boolean& value)
+        {
+            simple(value.get() ? TrueValue : FalseValue);
+        }
+
+        void content(const dsd::Array& value)
+        {
+            list(value);
+        }
+
+        void content(const dsd::Object& value)
+        {
+            list(value);
+        }
+
+        void content(const dsd::Member& value)
+        {
+            assert(value.key());
+            head(ArrayMajor, 2);
+            element(*value.key());
+
+            if (const auto v = value.value())
+                element(*v);
+            else
+                simple(NullValue);
+        }
+
+        void content(const dsd::Enum& value)
+        {
+            assert(value.value());
+            element(*value.value());
+        }
+
+        void content(const dsd::Select& value)
+        {
+            list(value);
+        }
+
+        void content(const dsd::Option& value)
+        {
+            list(value);
+        }
+
+        void content(const dsd::Extend& value)
+        {
+            list(value);
+        }
+
+        void content(const dsd::Ref& value)
+        {
+            text(value.symbol());
+        }
+
+        void content(const dsd::Holder& value)
+        {
+            assert(value.data());
+            element(*value.data());
+        }
+
+        template <typename ElementT>
+        void operator()(const ElementT& el, Kind kind)
+        {
+            head(ArrayMajor, ElementArity);
+            head(UnsignedMajor, kind);
+            name(el.element());
+
+            if (el.empty())
+                simple(UndefinedValue);
+            else
+                content(el.get());
+
+            info(el.meta(), renderSourceMaps_);
+            info(el.attributes(), renderSourceMaps_ || el.element() == "annotation");
+        }
+
+        void element(const IElement& e);
+    };
+
+    struct EncodeVisitor {
+        Encoder* encoder;
+
+        void operator()(const NullElement& el) const
+        {
+            (*encoder)(el, NullKind);
+        }
+
+        void operator()(const StringElement& el) const
+        {
+            (*encoder)(el, StringKind);
+        }
+
+        void operator()(const NumberElement& el) const
+        {
+            (*encoder)(el, NumberKind);
+        }
+
+        void operator()(const BooleanElement& el) const
+        {
+            (*encoder)(el, BooleanKind);
+        }
+
+        void operator()(const ArrayElement& el) const
+        {
+            (*encoder)(el, ArrayKind);
+        }
+
+        void operator()(const ObjectElement& el) const
+        {
+            (*encoder)(el, ObjectKind);
+        }
+
+        void operator()(const MemberElement& el) const
+        {
+            (*encoder)(el, MemberKind);
+        }
+
+        void operator()(const EnumElement& el) const
+        {
+            (*encoder)(el, EnumKind);
+        }
+
+        void operator()(const SelectElement& el) const
+        {
+            (*encoder)(el, SelectKind);
+        }
+
+        void operator()(const OptionElement& el) const
+        {
+            (*encoder)(el, OptionKind);
+        }
+
+        void operator()(const ExtendElement& el) const
+        {
+            (*encoder)(el, ExtendKind);
+        }
+
+        void operator()(const RefElement& el) const
+        {
+            (*encoder)(el, RefKind);
+        }
+
+        void operator()(const HolderElement& el) const
+        {
+            (*encoder)(el, HolderKind);
+        }
+    };
+
+    void Encoder::element(const IElement& e)
+    {
+        refract::visit(e, EncodeVisitor{ this });
+    }
+} // namespace
+
+namespace
+{
+    class Decoder
+    {
+        // bounds the recursion of element(), as in utils::so::parse_json
+        static constexpr int MaxDepth = 4096;
+
+        const unsigned char* it_;
+        const unsigned char* const end_;
+        std::vector<std::string> interned_;
+        int depth_ = 0;
+
+        [[noreturn]] static void fail(const std::string& what)
+        {
+            throw DeserializationError("malformed CBOR document: " + what);
+        }
+
+        unsigned peekMajor() const
+        {
+            if (it_ == end_)
+                fail("unexpected end of input");
+            return *it_ >> 5;
+        }
+
+        bool peekSimple(std::uint64_t value) const
+        {
+            return it_ != end_ && *it_ == ((SimpleMajor << 5) | value);
+        }
+
+        std::uint64_t head(unsigned major)
+        {
+            if (peekMajor() != major)
+                fail("unexpected data item");
+
+            const unsigned info = *it_++ & 0x1f;
+            if (info < 24)
+                return info;
+
+            if (info > 27)
+                fail("indefinite lengths are not supported");
+
+            const std::size_t bytes = std::size_t{ 1 } << (info - 24);
+            if (static_cast<std::size_t>(end_ - it_) < bytes)
+                fail("unexpected end of input");
+
+            std::uint64_t result = 0;
+            for (std::size_t i = 0; i < bytes; ++i)
+                result = (result << 8) | *it_++;
+            return result;
+        }
+
+        std::uint64_t length(unsigned major)
+        {
+            const std::uint64_t result = head(major);
+
+            // every item occupies at least one byte
+            if (result > static_cast<std::uint64_t>(end_ - it_))
+                fail("length exceeds input");
+            return result;
+        }
+
+        std::string text()
+        {
+            const std::size_t size = length(TextMajor);
+            std::string result(reinterpret_cast<const char*>(it_), size);
+            it_ += size;
+            return result;
+        }
+
+        std::string name()
+        {
+            if (peekMajor() == UnsignedMajor) {
+                const std::uint64_t index = head(UnsignedMajor);
+                if (index >= interned_.size())
+                    fail("unknown interned string");
+                return interned_[index];
+            }
+
+            interned_.emplace_back(text());
+            return interned_.back();
+        }
+
+        bool boolean()
+        {
+            if (peekSimple(TrueValue) || peekSimple(FalseValue))
+                return head(SimpleMajor) == TrueValue;
+            fail("expected boolean");
+        }
+
+        void null()
+        {
+            if (!peekSimple(NullValue))
+                fail("expected null");
+            ++it_;
+        }
+
+        template <typename ElementT>
+        std::unique_ptr<ElementT> list()
+        {
+            auto result = make_element<ElementT>();
+            const std::uint64_t size = length(ArrayMajor);
+            for (std::uint64_t i = 0; i < size; ++i)
+                result->get().push_back(element());
+            return result;
+        }
+
+        std::unique_ptr<SelectElement> select()
+        {
+            auto result = make_element<SelectElement>();
+            const std::uint64_t size = length(ArrayMajor);
+            for (std::uint64_t i = 0; i < size; ++i) {
+                auto option = element();
+                if (!get<OptionElement>(option.get()))
+                    fail("Select Element holding other than Option Elements");
+                result->get().push_back(std::unique_ptr<OptionElement>(static_cast<OptionElement*>(option.release())));
+            }
+            return result;
+        }
+
+        std::unique_ptr<MemberElement> member()
+        {
+            if (length(ArrayMajor) != 2)
+                fail("Member Element content must hold key and value");
+
+            auto key = element();
+            std::unique_ptr<IElement> value = nullptr;
+            if (peekSimple(NullValue))
+                null();
+            else
+                value = element();
+
+            return make_element<MemberElement>(std::move(key), std::move(value));
+        }
+
+        std::unique_ptr<IElement> content(std::uint64_t kind)
+        {
+            switch (kind) {
+                case NullKind:
+                    null();
+                    return make_element<NullElement>();
+                case StringKind:
+                    return make_element<StringElement>(text());
+                case NumberKind:
+                    return make_element<NumberElement>(text());
+                case BooleanKind:
+                    return make_element<BooleanElement>(boolean());
+                case ArrayKind:
+                    return list<ArrayElement>();
+                case ObjectKind:
+                    return list<ObjectElement>();
+                case MemberKind:
+                    return member();
+                case EnumKind:
+                    return make_element<EnumElement>(element());
+                case SelectKind:
+                    return select();
+                case OptionKind:
+                    return list<OptionElement>();
+                case ExtendKind:
+                    return list<ExtendElement>();
+                case RefKind:
+                    return make_element<RefElement>(text());
+                case HolderKind:
+                    return make_element<HolderElement>(element());
+                default:
+                    fail("unknown element kind");
+            }
+        }
+
+        std::unique_ptr<IElement> empty(std::uint64_t kind)
+        {
+            ++it_; // undefined
+
+            switch (kind) {
+                case NullKind:
+                    return make_empty<NullElement>();
+                case StringKind:
+                    return make_empty<StringElement>();
+                case NumberKind:
+                    return make_empty<NumberElement>();
+                case BooleanKind:
+                    return make_empty<BooleanElement>();
+                case ArrayKind:
+                    return make_empty<ArrayElement>();
+                case ObjectKind:
+                    return make_empty<ObjectElement>();
+                case MemberKind:
+                    return make_empty<MemberElement>();
+                case EnumKind:
+                    return make_empty<EnumElement>();
+                case SelectKind:
+                    return make_empty<SelectElement>();
+                case OptionKind:
+                    return make_empty<OptionElement>();
+                case ExtendKind:
+                    return make_empty<ExtendElement>();
+                case RefKind:
+                    return make_empty<RefElement>();
+                case HolderKind:
+                    return make_empty<HolderElement>();
+                default:
+                    fail("unknown element kind");
+            }
+        }
+
+        void info(InfoElements& info)
+        {
+            const std::uint64_t size = length(MapMajor);
+            for (std::uint64_t i = 0; i < size; ++i) {
+                auto key = name();
+                info.set(key, element());
+            }
+        }
+
+    public:
+        Decoder(const char* data, std::size_t size)
+            : it_(reinterpret_cast<const unsigned char*>(data)),
+              end_(reinterpret_cast<const unsigned char*>(data) + size),
+              interned_()
+        {
+        }
+
+        std::unique_ptr<IElement> element()
+        {
+            if (++depth_ > MaxDepth)
+                fail("nesting too deep");
+
+            if (length(ArrayMajor) != ElementArity)
+                fail("unexpected element arity");
+
+            const std::uint64_t kind = head(UnsignedMajor);
+            const std::string elementName = name();
+
+            auto result = peekSimple(UndefinedValue) ? empty(kind) : content(kind);
+            result->element(elementName);
+
+            info(result->meta());
+            info(result->attributes());
+
+            --depth_;
+            return result;
+        }
+
+        std::unique_ptr<IElement> document()
+        {
+            if (head(TagMajor) != SelfDescribeTag)
+                fail("missing self-describe tag");
+
+            if (length(ArrayMajor) != 2)
+                fail("unexpected document arity");
+
+            if (head(UnsignedMajor) != FormatVersion)
+                fail("unsupported format version");
+
+            auto result = element();
+
+            if (it_ != end_)
+                fail("trailing data");
+
+            return result;
+        }
+    };
+} // namespace
+
+std::string serialize::renderCbor(const IElement& el, bool sourceMaps)
+{
+    LOG(info) << "Starting API Elements -> CBOR serialization";
+
+    Encoder encoder(sourceMaps);
+    encoder.head(TagMajor, SelfDescribeTag);
+    encoder.head(ArrayMajor, 2);
+    encoder.head(UnsignedMajor, FormatVersion);
+    encoder.element(el);
+
+    return encoder.release();
+}
+
+std::unique_ptr<IElement> serialize::parseCbor(const char* data, std::size_t size)
+{
+    LOG(info) << "Starting CBOR -> API Elements deserialization";
+
+    assert(data || size == 0);
+    return Decoder(data, size).document();
+}
@@ -0,0 +1,52 @@
+//
+//  refract/SerializeCbor.h
+//  librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef REFRACT_SERIALIZE_CBOR_H
+#define REFRACT_SERIALIZE_CBOR_H
+
+#include "ElementIfc.h"
+
+#include <memory>
+#include <string>
+
+namespace refract
+{
+    namespace serialize
+    {
+        ///
+        /// Translate an API Element tree to a compact CBOR (RFC 8949) document
+        ///
+        /// Every Element is a five-item array holding its DSD kind, name,
+        /// content, meta and attributes. Element names and info element keys
+        /// are interned: the first occurrence of such a string is a text
+        /// string, every later one an unsigned integer indexing all interned
+        /// strings in order of appearance.
+        ///
+        /// @param el           API Element to be translated
+        /// @param sourceMaps   whether to include source maps; source maps on
+        ///                     Annotation Elements are always included
+        ///
+        /// @return             CBOR document; may contain null bytes
+        ///
+        std::string renderCbor(const IElement& el, bool sourceMaps);
+
+        ///
+        /// Restore an API Element tree from a document created by renderCbor
+        ///
+        /// @param data     CBOR document
+        /// @param size     length of the document in bytes
+        ///
+        /// @throw DeserializationError if the document is malformed
+        ///
+        /// @return         restored API Element tree
+        ///
+        std::unique_ptr<IElement> parseCbor(const char* data, std::size_t size);
+
+    } // namespace serialize
+} // namespace refract
+
+#endif
@@ -10,6 +10,8 @@
 
 #include "../utils/log/Trivial.h"
 #include "Element.h"
+#include "ElementUtils.h"
+#include "Exception.h"
 
 using namespace refract;
 using namespace serialize;
@@ -203,3 +205,310 @@ so::Value serialize::renderSo(const IElement& el, bool sourceMaps)
     LOG(info) << "Starting API Elements -> SO serialization";
     return serializeAny(el, sourceMaps);
 }
+
+namespace
+{
+    enum class Kind
+    {
+        Null,
+        String,
+        Number,
+        Boolean,
+        Array,
+        Object,
+        Member,
+        Enum,
+        Select,
+        Option,
+        Extend,
+        Ref,
+        Holder
+    };
+
+    [[noreturn]] void fail(const std::string& what)
+    {
+        throw DeserializationError("invalid API Element: " + what);
+    }
+
+    bool kindOfBase(const std::string& name, Kind& kind)
+    {
+        static const struct {
+            const char* name;
+            Kind kind;
+        } bases[] = {
+            { "null", Kind::Null },
+            { "string", Kind::String },
+            { "number", Kind::Number },
+            { "boolean", Kind::Boolean },
+            { "array", Kind::Array },
+            { "object", Kind::Object },
+            { "member", Kind::Member },
+            { "enum", Kind::Enum },
+            { "select", Kind::Select },
+            { "option", Kind::Option },
+            { "extend", Kind::Extend },
+            { "ref", Kind::Ref },
+        };
+
+        for (const auto& base : bases)
+            if (name == base.name) {
+                kind = base.kind;
+                return true;
+            }
+
+        return false;
+    }
+
+    const std::string* nameOf(const so::Value& value)
+    {
+        if (const auto* obj = mpark::get_if<so::Object>(&value))
+            for (const auto& entry : obj->data)
+                if (entry.first == "element")
+                    if (const auto* name = mpark::get_if<so::String>(&entry.second))
+                        return &name->data;
+        return nullptr;
+    }
+
+    struct KindOfContentVisitor {
+        Kind operator()(const so::Null&) const
+        {
+            return Kind::Null;
+        }
+
+        Kind operator()(const so::True&) const
+        {
+            return Kind::Boolean;
+        }
+
+        Kind operator()(const so::False&) const
+        {
+            return Kind::Boolean;
+        }
+
+        Kind operator()(const so::String&) const
+        {
+            return Kind::String;
+        }
+
+        Kind operator()(const so::Number&) const
+        {
+            return Kind::Number;
+        }
+
+        Kind operator()(const so::Object& value) const
+        {
+            for (const auto& entry : value.data)
+                if (entry.first == "key")
+                    return Kind::Member;
+            return Kind::Holder;
+        }
+
+        Kind operator()(const so::Array& value) const
+        {
+            for (const auto& item : value.data)
+                if (const auto* name = nameOf(item))
+                    if (*name == "member" || *name == "select")
+                        return Kind::Object;
+            return Kind::Array;
+        }
+    };
+
+    std::unique_ptr<IElement> parseAny(so::Value&& value);
+
+    std::string& stringOf(so::Value& value)
+    {
+        if (auto* str = mpark::get_if<so::String>(&value))
+            return str->data;
+        fail("expected string content");
+    }
+
+    template <typename ElementT>
+    std::unique_ptr<IElement> parseListContent(so::Value& value)
+    {
+        auto* items = mpark::get_if<so::Array>(&value);
+        if (!items)
+            fail("expected array content");
+
+        auto result = make_element<ElementT>();
+        for (auto& item : items->data)
+            result->get().push_back(parseAny(std::move(item)));
+        return std::move(result);
+    }
+
+    std::unique_ptr<IElement> parseSelectContent(so::Value& value)
+    {
+        auto* items = mpark::get_if<so::Array>(&value);
+        if (!items)
+            fail("expected array content");
+
+        auto result = make_element<SelectElement>();
+        for (auto& item : items->data) {
+            auto option = parseAny(std::move(item));
+            if (!get<OptionElement>(option.get()))
+                fail("Select Element holding other than Option Elements");
+            result->get().push_back(std::unique_ptr<OptionElement>(static_cast<OptionElement*>(option.release())));
+        }
+        return std::move(result);
+    }
+
+    std::unique_ptr<IElement> parseMemberContent(so::Value& value)
+    {
+        auto* obj = mpark::get_if<so::Object>(&value);
+        if (!obj)
+            fail("expected key/value content");
+
+        std::unique_ptr<IElement> key = nullptr;
+        std::unique_ptr<IElement> val = nullptr;
+
+        for (auto& entry : obj->data) {
+            if (entry.first == "key")
+                key = parseAny(std::move(entry.second));
+            else if (entry.first == "value")
+                val = parseAny(std::move(entry.second));
+            else
+                fail("unexpected property `" + entry.first + "` in Member Element content");
+        }
+
+        if (!key)
+            fail("Member Element content without key");
+
+        return make_element<MemberElement>(std::move(key), std::move(val));
+    }
+
+    std::unique_ptr<IElement> parseContent(Kind kind, so::Value& value)
+    {
+        switch (kind) {
+            case Kind::Null:
+                if (!mpark::holds_alternative<so::Null>(value))
+                    fail("expected null content");
+                return make_element<NullElement>();
+            case Kind::String:
+                return make_element<StringElement>(std::move(stringOf(value)));
+            case Kind::Number:
+                if (auto* num = mpark::get_if<so::Number>(&value))
+                    return make_element<NumberElement>(std::move(num->data));
+                fail("expected number content");
+            case Kind::Boolean:
+                if (mpark::holds_alternative<so::True>(value))
+                    return make_element<BooleanElement>(true);
+                if (mpark::holds_alternative<so::False>(value))
+                    return make_element<BooleanElement>(false);
+                fail("expected boolean content");
+            case Kind::Array:
+                return parseListContent<ArrayElement>(value);
+            case Kind::Object:
+                return parseListContent<ObjectElement>(value);
+            case Kind::Member:
+                return parseMemberContent(value);
+            case Kind::Enum:
+                return make_element<EnumElement>(parseAny(std::move(value)));
+            case Kind::Select:
+                return parseSelectContent(value);
+            case Kind::Option:
+                return parseListContent<OptionElement>(value);
+            case Kind::Extend:
+                return parseListContent<ExtendElement>(value);
+            case Kind::Ref:
+                return make_element<RefElement>(std::move(stringOf(value)));
+            case Kind::Holder:
+                return make_element<HolderElement>(parseAny(std::move(value)));
+        }
+        fail("unknown element kind");
+    }
+
+    std::unique_ptr<IElement> parseEmpty(Kind kind)
+    {
+        switch (kind) {
+            case Kind::Null:
+                return make_empty<NullElement>();
+            case Kind::String:
+                return make_empty<StringElement>();
+            case Kind::Number:
+                return make_empty<NumberElement>();
+            case Kind::Boolean:
+                return make_empty<BooleanElement>();
+            case Kind::Array:
+                return make_empty<ArrayElement>();
+            case Kind::Object:
+                return make_empty<ObjectElement>();
+            case Kind::Member:
+                return make_empty<MemberElement>();
+            case Kind::Enum:
+                return make_empty<EnumElement>();
+            case Kind::Select:
+                return make_empty<SelectElement>();
+            case Kind::Option:
+                return make_empty<OptionElement>();
+            case Kind::Extend:
+                return make_empty<ExtendElement>();
+            case Kind::Ref:
+                return make_empty<RefElement>();
+            case Kind::Holder:
+                return make_empty<HolderElement>();
+        }
+        fail("unknown element kind");
+    }
+
+    void parseInfo(InfoElements& info, so::Value& value)
+    {
+        auto* obj = mpark::get_if<so::Object>(&value);
+        if (!obj)
+            fail("meta and attributes must be objects");
+
+        for (auto& entry : obj->data)
+            info.set(entry.first, parseAny(std::move(entry.second)));
+    }
+
+    std::unique_ptr<IElement> parseAny(so::Value&& value)
+    {
+        auto* obj = mpark::get_if<so::Object>(&value);
+        if (!obj)
+            fail("expected object");
+
+        so::String* name = nullptr;
+        so::Value* meta = nullptr;
+        so::Value* attributes = nullptr;
+        so::Value* content = nullptr;
+
+        for (auto& entry : obj->data) {
+            if (entry.first == "element") {
+                name = mpark::get_if<so::String>(&entry.second);
+                if (!name)
+                    fail("element name must be a string");
+            } else if (entry.first == "meta")
+                meta = &entry.second;
+            else if (entry.first == "attributes")
+                attributes = &entry.second;
+            else if (entry.first == "content")
+                content = &entry.second;
+            else
+                fail("unexpected property `" + entry.first + "`");
+        }
+
+        if (!name)
+            fail("missing element name");
+
+        LOG(debug) << "Deserializing element `" << name->data << "`";
+
+        Kind kind = Kind::Object;
+        if (!kindOfBase(name->data, kind) && content)
+            kind = mpark::visit(KindOfContentVisitor{}, *content);
+
+        auto result = content ? parseContent(kind, *content) : parseEmpty(kind);
+        result->element(name->data);
+
+        if (meta)
+            parseInfo(result->meta(), *meta);
+
+        if (attributes)
+            parseInfo(result->attributes(), *attributes);
+
+        return result;
+    }
+} // namespace
+
+std::unique_ptr<IElement> serialize::parseSo(so::Value&& value)
+{
+    LOG(info) << "Starting SO -> API Elements deserialization";
+    return parseAny(std::move(value));
+}
@@ -12,6 +12,8 @@
 #include "../utils/so/Value.h"
 #include "ElementIfc.h"
 
+#include <memory>
+
 namespace refract
 {
     namespace serialize
@@ -28,6 +30,24 @@ namespace refract
         ///
         drafter::utils::so::Value renderSo(const IElement& el, bool sourceMaps);
 
+        ///
+        /// Restore an API Element tree from its Simple Object format
+        ///
+        /// The Simple Object format does not state which DSD an Element
+        /// uses. Elements named after a base Element get its DSD, others
+        /// one matching their content: Objects for lists holding Member or
+        /// Select Elements, Arrays for other lists, Members for `key`/`value`
+        /// pairs and Holders for a single Element. Empty Elements of unknown
+        /// DSD become Objects. Rendering the result again gives the input.
+        ///
+        /// @param value    Simple Object, consumed to avoid copying strings
+        ///
+        /// @throw DeserializationError if the value is not an API Element
+        ///
+        /// @return         restored API Element tree
+        ///
+        std::unique_ptr<IElement> parseSo(drafter::utils::so::Value&& value);
+
     } // namespace serialize
 } // namespace refract
 
@@ -11,6 +11,9 @@
 #include "ElementFwd.h"
 #include "ElementIfc.h"
 
+#include <new>
+#include <type_traits>
+
 namespace refract
 {
 
@@ -68,21 +71,67 @@ namespace refract
 
 #undef APPLY_VISIT_IMPL
 
-    class Visitor
+    ///
+    /// Owner of an ApplyImpl constructed in place
+    ///
+    /// ApplyImpl only refers to its functor, so it has the same size for
+    /// any functor and fits a fixed buffer; visiting needs no allocation.
+    ///
+    class InplaceApply
     {
+        struct AnyFunctor {
+            template <typename T>
+            void operator()(const T&)
+            {
+            }
+        };
 
-    private:
+        using Storage = typename std::aligned_storage<sizeof(ApplyImpl<AnyFunctor>),
+            alignof(ApplyImpl<AnyFunctor>)>::type;
+
+        Storage storage;
         IApply* apply;
 
     public:
         template <typename Functor>
-        Visitor(Functor& functor) : apply(new ApplyImpl<Functor>(functor))
+        explicit InplaceApply(Functor& functor)
+        {
+            static_assert(sizeof(ApplyImpl<Functor>) <= sizeof(Storage), "ApplyImpl exceeds in place storage");
+            static_assert(alignof(ApplyImpl<Functor>) <= alignof(Storage), "ApplyImpl exceeds in place storage");
+            apply = new (&storage) ApplyImpl<Functor>(functor);
+        }
+
+        InplaceApply(const InplaceApply&) = delete;
+        InplaceApply& operator=(const InplaceApply&) = delete;
+
+        ~InplaceApply()
+        {
+            apply->~IApply();
+        }
+
+        IApply* get() const noexcept
         {
+            return apply;
         }
-        virtual ~Visitor()
+
+        IApply* operator->() const noexcept
+        {
+            return apply;
+        }
+    };
+
+    class Visitor
+    {
+
+    private:
+        InplaceApply apply;
+
+    public:
+        template <typename Functor>
+        Visitor(Functor& functor) : apply(functor)
         {
-            delete apply;
         }
+        virtual ~Visitor() {}
 
         template <typename T>
         void visit(const T& e)
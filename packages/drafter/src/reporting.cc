@@ -41,8 +41,7 @@ namespace
 
     void PrintAnnotation(const std::string& prefix,
         const snowcrash::SourceAnnotation& annotation,
-        const std::string& source,
-        const bool useLineNumbers)
+        const NewLinesIndex* linesEndIndex)
     {
 
         std::cerr << prefix;
@@ -55,21 +54,15 @@ namespace
             std::cerr << " " << annotation.message;
         }
 
-        NewLinesIndex linesEndIndex;
-
-        if (useLineNumbers) {
-            linesEndIndex = GetLinesEndIndex(source);
-        }
-
         if (!annotation.location.empty()) {
 
             for (mdp::CharactersRangeSet::const_iterator it = annotation.location.begin();
                  it != annotation.location.end();
                  ++it) {
 
-                if (useLineNumbers) {
+                if (linesEndIndex) {
 
-                    auto annotationPosition = GetLineFromMap(linesEndIndex, *it);
+                    auto annotationPosition = GetLineFromMap(*linesEndIndex, *it);
 
                     std::cerr << "; line " << annotationPosition.fromLine << ", column "
                               << annotationPosition.fromColumn;
@@ -85,16 +78,52 @@ namespace
         std::cerr << std::endl;
     }
 
+    /// Line and column attributes attached to a source map position
+    bool LineColumnInfo(const NumberElement& position, std::size_t& line, std::size_t& column)
+    {
+        const NumberElement* lineElement = FindCollectionMemberValue<NumberElement>(position.attributes(), "line");
+        const NumberElement* columnElement = FindCollectionMemberValue<NumberElement>(position.attributes(), "column");
+
+        if (!lineElement || !columnElement)
+            return false;
+
+        line = static_cast<std::size_t>(static_cast<std::int64_t>(lineElement->get()));
+        column = static_cast<std::size_t>(static_cast<std::int64_t>(columnElement->get()));
+        return true;
+    }
+
     struct AnnotationToString {
 
-        std::vector<size_t> linesEndIndex;
+        const char* source;
+        const std::size_t size;
         const bool useLineNumbers;
 
-        AnnotationToString(const std::string& source, const bool useLineNumbers) : useLineNumbers(useLineNumbers)
+        // built for annotations lacking line and column attributes only
+        NewLinesIndex linesEndIndex;
+        bool linesEndIndexBuilt = false;
+
+        AnnotationToString(const char* source, std::size_t size, const bool useLineNumbers)
+            : source(source), size(size), useLineNumbers(useLineNumbers)
+        {
+        }
+
+        AnnotationPosition position(const NumberElement& loc, const NumberElement& len)
         {
-            if (useLineNumbers) {
-                linesEndIndex = GetLinesEndIndex(source);
+            AnnotationPosition result;
+
+            // conversion already resolved annotation positions
+            if (LineColumnInfo(loc, result.fromLine, result.fromColumn)
+                && LineColumnInfo(len, result.toLine, result.toColumn)) {
+                return result;
+            }
+
+            if (!linesEndIndexBuilt) {
+                linesEndIndex = GetLinesEndIndex(std::string(source, size));
+                linesEndIndexBuilt = true;
             }
+
+            mdp::Range pos(static_cast<std::int64_t>(loc.get()), static_cast<std::int64_t>(len.get()));
+            return GetLineFromMap(linesEndIndex, pos);
         }
 
         const std::string location(const IElement* sourceMap)
@@ -109,8 +138,7 @@ namespace
 
                     if (useLineNumbers) {
 
-                        mdp::Range pos(static_cast<std::int64_t>(loc->get()), static_cast<std::int64_t>(len->get()));
-                        const auto annotationPosition = GetLineFromMap(linesEndIndex, pos);
+                        const auto annotationPosition = position(*loc, *len);
 
                         output << "; line " << annotationPosition.fromLine << ", column "
                                << annotationPosition.fromColumn;
@@ -180,31 +208,53 @@ void PrintReport(const snowcrash::Report& report, const std::string& source, con
 
     std::cerr << std::endl;
 
+    NewLinesIndex linesEndIndex;
+
+    if (isUseLineNumbers) {
+        linesEndIndex = GetLinesEndIndex(source);
+    }
+
+    const NewLinesIndex* index = isUseLineNumbers ? &linesEndIndex : nullptr;
+
     if (report.error.code == sc::Error::OK) {
         std::cerr << "OK.\n";
     } else {
-        PrintAnnotation("error:", report.error, source, isUseLineNumbers);
+        PrintAnnotation("error:", report.error, index);
     }
 
     for (snowcrash::Warnings::const_iterator it = report.warnings.begin(); it != report.warnings.end(); ++it) {
-        PrintAnnotation("warning:", *it, source, isUseLineNumbers);
+        PrintAnnotation("warning:", *it, index);
     }
 }
 
-void PrintReport(const drafter_result* result, const std::string& source, const bool useLineNumbers, const int error)
+void PrintReport(const drafter_result* result,
+    const char* source,
+    std::size_t size,
+    const bool useLineNumbers,
+    const int error)
 {
-    std::cerr << std::endl;
+    PrintReport(std::cerr, result, source, size, useLineNumbers, error);
+}
+
+void PrintReport(std::ostream& out,
+    const drafter_result* result,
+    const char* source,
+    std::size_t size,
+    const bool useLineNumbers,
+    const int error)
+{
+    out << std::endl;
 
     FilterVisitor filter(query::Element("annotation"));
     Iterate<Children> iterate(filter);
     iterate(*result);
 
     if (error == sc::Error::OK) {
-        std::cerr << "OK.\n";
+        out << "OK.\n";
     }
 
     std::transform(filter.elements().begin(),
         filter.elements().end(),
-        std::ostream_iterator<std::string>(std::cerr, "\n"),
-        AnnotationToString(source, useLineNumbers));
+        std::ostream_iterator<std::string>(out, "\n"),
+        AnnotationToString(source, size, useLineNumbers));
 }
@@ -12,6 +12,8 @@
 #include "drafter.h"
 #include "SourceAnnotation.h"
 
+#include <iosfwd>
+
 /**
  *  \brief Print parser report to stderr.
  *
@@ -26,9 +28,24 @@ void PrintReport(const snowcrash::Report& report, const std::string& source, con
  *
  *  \param report A parser report to print
  *  \param source Source data
+ *  \param size Length of source data
  *  \param useLineNumbers True if the annotations needs to be printed by line and column number
  *  \param error - code form parsing
  */
-void PrintReport(const drafter_result*, const std::string& source, const bool useLineNumbers, const int error);
+void PrintReport(
+    const drafter_result*, const char* source, std::size_t size, const bool useLineNumbers, const int error);
+
+/**
+ *  \brief Print parser report to given stream.
+ *
+ *  \param out Stream to print to
+ *  \see PrintReport
+ */
+void PrintReport(std::ostream& out,
+    const drafter_result*,
+    const char* source,
+    std::size_t size,
+    const bool useLineNumbers,
+    const int error);
 
 #endif // #ifndef DRAFTER_REPORTING_H
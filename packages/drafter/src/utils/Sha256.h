@@ -0,0 +1,52 @@
+//
+//  utils/Sha256.h
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef DRAFTER_UTILS_SHA256_H
+#define DRAFTER_UTILS_SHA256_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace drafter
+{
+    namespace utils
+    {
+        ///
+        /// Incremental SHA-256 digest, FIPS 180-4
+        ///
+        class Sha256
+        {
+        public:
+            using digest_type = std::array<std::uint8_t, 32>;
+
+        private:
+            std::array<std::uint32_t, 8> state_;
+            std::array<std::uint8_t, 64> block_;
+            std::size_t blockSize_ = 0;
+            std::uint64_t length_ = 0;
+
+            void compress(const std::uint8_t* block) noexcept;
+
+        public:
+            Sha256() noexcept;
+
+            /// Append data to the message
+            Sha256& update(const void* data, std::size_t size) noexcept;
+
+            /// Digest of the message so far; the digest must not be updated
+            ///     afterwards
+            digest_type finish() noexcept;
+        };
+
+        /// Lower case hexadecimal digits of a digest
+        std::string to_hex(const Sha256::digest_type& digest);
+    }
+}
+
+#endif
@@ -56,22 +56,22 @@ const char* log::severity_to_str(severity s)
 }
 
 trivial_entry::trivial_entry(trivial_log& log, severity svrty, size_t line, const char* file)
-    : log_(log), severity_(svrty), log_lock_(log_.mtx())
+    : out_(enough_severity(svrty) ? log.out() : nullptr), severity_(svrty), log_lock_(log.mtx(), std::defer_lock)
 {
-    if (enough_severity(severity_))
-        if (auto* out = log_.out()) {
-            *out << '[' << severity_to_str(svrty) << "]";
-            *out << '[' << std::this_thread::get_id() << "]";
-            *out << '[' << file << ':' << line << "] ";
-        }
+    // disabled logging must not serialize concurrent parsers
+    if (out_) {
+        log_lock_.lock();
+        *out_ << '[' << severity_to_str(svrty) << "]";
+        *out_ << '[' << std::this_thread::get_id() << "]";
+        *out_ << '[' << file << ':' << line << "] ";
+    }
 }
 
 trivial_entry::~trivial_entry()
 {
-    if (enough_severity(severity_))
-        if (auto* out = log_.out()) {
-            *out << '\n'; // TODO @tjanc@ could throw
-        }
+    if (out_) {
+        *out_ << '\n'; // TODO @tjanc@ could throw
+    }
 }
 
 std::mutex& trivial_log::mtx() const
@@ -81,7 +81,7 @@ std::mutex& trivial_log::mtx() const
 
 std::ostream* trivial_log::out()
 {
-    return out_;
+    return out_.load(std::memory_order_acquire);
 }
 
 void trivial_log::enable()
@@ -89,6 +89,6 @@ void trivial_log::enable()
     std::lock_guard<std::mutex> lock(write_mtx_);
 #ifdef LOGGING
     static std::ofstream log_file_{ "drafter.log" };
-    out_ = &log_file_;
+    out_.store(&log_file_, std::memory_order_release);
 #endif
 }
@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <cstdio>
 #include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <iterator>
 #include <string>
@@ -23,122 +24,110 @@ using namespace so;
 
 namespace
 {
-    template <typename It>
-    It json_utf_char(It out, unsigned int c)
+    void json_utf_char(std::string& out, unsigned int c)
     {
         char u_sym_buf[7];
         std::snprintf(u_sym_buf, 7, "\\u%04x", c);
-        return std::copy( //
-            u_sym_buf,
-            u_sym_buf + 6,
-            out);
+        out.append(u_sym_buf, 6);
     }
 
-    template <typename ItI, typename ItO>
-    ItO escape_json_string(ItI b, ItI e, ItO out)
+    ///
+    /// Append a JSON-escaped copy of given string to a buffer
+    ///
+    /// Runs of bytes not needing escaping are appended in bulk.
+    ///
+    void escape_json_string(const std::string& in, std::string& out)
     {
+        const char* b = in.data();
+        const char* const e = b + in.size();
+        const char* run = b;
+
         for (; b != e; ++b) {
+            // unsigned int representation
+            std::uint8_t c = static_cast<std::uint8_t>(*b);
+            if (c > 0x1f && c != '"' && c != '\\') // non-control
+                continue;
+
+            out.append(run, b);
+            run = b + 1;
 
-            char byte = *b;
-            switch (byte) {
-                case '\"':
-                    *out = '\\';
-                    ++out;
-                    *out = '"';
-                    ++out;
+            switch (c) {
+                case '"':
+                    out.append("\\\"", 2);
                     break;
                 case '\\':
-                    *out = '\\';
-                    ++out;
-                    *out = '\\';
-                    ++out;
+                    out.append("\\\\", 2);
                     break;
                 case '\b':
-                    *out = '\\';
-                    ++out;
-                    *out = 'b';
-                    ++out;
+                    out.append("\\b", 2);
                     break;
                 case '\f':
-                    *out = '\\';
-                    ++out;
-                    *out = 'f';
-                    ++out;
+                    out.append("\\f", 2);
                     break;
                 case '\n':
-                    *out = '\\';
-                    ++out;
-                    *out = 'n';
-                    ++out;
+                    out.append("\\n", 2);
                     break;
                 case '\r':
-                    *out = '\\';
-                    ++out;
-                    *out = 'r';
-                    ++out;
+                    out.append("\\r", 2);
                     break;
                 case '\t':
-                    *out = '\\';
-                    ++out;
-                    *out = 't';
-                    ++out;
-                    break;
-                default: {
-                    // unsigned int representation
-                    std::uint8_t c = static_cast<std::uint8_t>(byte);
-                    if (c > 0x1f) { // non-control
-                        *out = byte;
-                        ++out;
-                    } else { // escaped control sequences
-                        out = json_utf_char(out, c);
-                    }
-                }
+                    out.append("\\t", 2);
+                    break;
+                default: // escaped control sequences
+                    json_utf_char(out, c);
             }
         }
-        return out;
+        out.append(run, e);
     }
 
-    std::ostream& break_indent(std::ostream& out, int indent)
+    void break_indent(std::string& out, int indent)
     {
-        out << '\n';
-        for (; indent > 0; --indent)
-            out << "  ";
-        return out;
+        out += '\n';
+        out.append(2 * std::max(indent, 0), ' ');
     }
 
+    // bytes a json_printer buffers before writing them to its stream
+    constexpr std::size_t stream_chunk = 64 * 1024;
+
     template <bool Packed = true>
     struct json_printer final {
-        std::ostream& out;
+        std::string& out;
         const int indent;
+        std::ostream* const stream; // if set, receives out in chunks of about stream_chunk bytes
+
+        void flush() const
+        {
+            if (stream && out.size() >= stream_chunk) {
+                stream->write(out.data(), out.size());
+                out.clear();
+            }
+        }
 
         void operator()(const Null& value) const
         {
-            out << "null";
+            out.append("null", 4);
         }
 
         void operator()(const True& value) const
         {
-            out << "true";
+            out.append("true", 4);
         }
 
         void operator()(const False& value) const
         {
-            out << "false";
+            out.append("false", 5);
         }
 
         void operator()(const String& value) const
         {
-            out << '"';
-            escape_json_string( //
-                value.data.begin(),
-                value.data.end(),
-                std::ostream_iterator<char>(out));
-            out << '"';
+            out += '"';
+            escape_json_string(value.data, out);
+            out += '"';
         }
 
         void operator()(const Number& value) const
         {
-            out << value.data;
+            out += value.data;
         }
 
         void operator()(const Object& value) const;
@@ -146,68 +135,411 @@ namespace
     };
 
     template <bool Packed>
-    void visit(const Value& obj, std::ostream& out, int indent = 0)
+    void visit(const Value& obj, std::string& out, int indent = 0, std::ostream* stream = nullptr)
     {
-        mpark::visit(json_printer<Packed>{ out, indent }, obj);
+        mpark::visit(json_printer<Packed>{ out, indent, stream }, obj);
     }
 
     template <bool Packed>
     void json_printer<Packed>::operator()(const Object& value) const
     {
-        out << '{';
+        out += '{';
         int commas = value.data.size() - 1;
         for (const auto& m : value.data) {
             if (!Packed)
                 break_indent(out, indent + 1);
 
-            out << '"';
-            escape_json_string(m.first.begin(), m.first.end(), std::ostream_iterator<char>(out));
-            out << "\":";
+            out += '"';
+            escape_json_string(m.first, out);
+            out.append("\":", 2);
 
             if (!Packed)
-                out << ' ';
+                out += ' ';
 
-            visit<Packed>(m.second, out, indent + 1);
+            visit<Packed>(m.second, out, indent + 1, stream);
 
             if (commas > 0) {
-                out << ',';
+                out += ',';
                 --commas;
             }
+
+            flush();
         }
         if (!(Packed || value.data.empty()))
             break_indent(out, indent);
-        out << '}';
+        out += '}';
     }
 
     template <bool Packed>
     void json_printer<Packed>::operator()(const Array& value) const
     {
-        out << '[';
+        out += '[';
         int commas = value.data.size() - 1;
         for (const auto& m : value.data) {
             if (!Packed)
                 break_indent(out, indent + 1);
-            visit<Packed>(m, out, indent + 1);
+            visit<Packed>(m, out, indent + 1, stream);
 
             if (commas > 0) {
-                out << ',';
+                out += ',';
                 --commas;
             }
+
+            flush();
         }
         if (!(Packed || value.data.empty()))
             break_indent(out, indent);
-        out << ']';
+        out += ']';
     }
 } // namespace
 
-std::ostream& so::serialize_json(std::ostream& out, const Value& obj)
+namespace
+{
+    class json_parser final
+    {
+        static constexpr int max_depth = 4096;
+
+        const char* const begin;
+        const char* const end;
+        const char* it;
+        int depth = 0;
+
+        [[noreturn]] void fail(const char* what) const
+        {
+            throw JsonParseError(what, it - begin);
+        }
+
+        void skip_whitespace()
+        {
+            while (it != end && (*it == ' ' || *it == '\n' || *it == '\r' || *it == '\t'))
+                ++it;
+        }
+
+        void expect(char c)
+        {
+            if (it == end || *it != c)
+                fail("unexpected character");
+            ++it;
+        }
+
+        void literal(const char* lit, std::size_t size)
+        {
+            if (static_cast<std::size_t>(end - it) < size || !std::equal(lit, lit + size, it))
+                fail("invalid literal");
+            it += size;
+        }
+
+        unsigned hex4()
+        {
+            if (end - it < 4)
+                fail("unexpected end of input");
+
+            unsigned result = 0;
+            for (int i = 0; i < 4; ++i, ++it) {
+                const char c = *it;
+                result <<= 4;
+                if (c >= '0' && c <= '9')
+                    result |= c - '0';
+                else if (c >= 'a' && c <= 'f')
+                    result |= c - 'a' + 10;
+                else if (c >= 'A' && c <= 'F')
+                    result |= c - 'A' + 10;
+                else
+                    fail("invalid unicode escape");
+            }
+            return result;
+        }
+
+        static void append_utf8(std::string& out, unsigned cp)
+        {
+            if (cp < 0x80) {
+                out += static_cast<char>(cp);
+            } else if (cp < 0x800) {
+                out += static_cast<char>(0xc0 | (cp >> 6));
+                out += static_cast<char>(0x80 | (cp & 0x3f));
+            } else if (cp < 0x10000) {
+                out += static_cast<char>(0xe0 | (cp >> 12));
+                out += static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+                out += static_cast<char>(0x80 | (cp & 0x3f));
+            } else {
+                out += static_cast<char>(0xf0 | (cp >> 18));
+                out += static_cast<char>(0x80 | ((cp >> 12) & 0x3f));
+                out += static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+                out += static_cast<char>(0x80 | (cp & 0x3f));
+            }
+        }
+
+        void escape(std::string& out)
+        {
+            if (it == end)
+                fail("unexpected end of input");
+
+            switch (*it++) {
+                case '"':
+                    out += '"';
+                    break;
+                case '\\':
+                    out += '\\';
+                    break;
+                case '/':
+                    out += '/';
+                    break;
+                case 'b':
+                    out += '\b';
+                    break;
+                case 'f':
+                    out += '\f';
+                    break;
+                case 'n':
+                    out += '\n';
+                    break;
+                case 'r':
+                    out += '\r';
+                    break;
+                case 't':
+                    out += '\t';
+                    break;
+                case 'u': {
+                    unsigned cp = hex4();
+                    if (cp >= 0xd800 && cp < 0xdc00) { // surrogate pair
+                        if (end - it < 2 || it[0] != '\\' || it[1] != 'u')
+                            fail("unpaired surrogate");
+                        it += 2;
+                        const unsigned low = hex4();
+                        if (low < 0xdc00 || low >= 0xe000)
+                            fail("unpaired surrogate");
+                        cp = 0x10000 + ((cp - 0xd800) << 10) + (low - 0xdc00);
+                    } else if (cp >= 0xdc00 && cp < 0xe000) {
+                        fail("unpaired surrogate");
+                    }
+                    append_utf8(out, cp);
+                    break;
+                }
+                default:
+                    --it;
+                    fail("invalid escape sequence");
+            }
+        }
+
+        ///
+        /// Unescape a string into given buffer
+        ///
+        /// Runs of bytes not needing unescaping are appended in bulk.
+        ///
+        void string(std::string& out)
+        {
+            expect('"');
+
+            const char* run = it;
+            while (it != end) {
+                const auto c = static_cast<std::uint8_t>(*it);
+                if (c > 0x1f && c != '"' && c != '\\') {
+                    ++it;
+                    continue;
+                }
+
+                out.append(run, it);
+
+                if (c == '"') {
+                    ++it;
+                    return;
+                }
+
+                if (c != '\\')
+                    fail("unescaped control character in string");
+
+                ++it;
+                escape(out);
+                run = it;
+            }
+
+            fail("unterminated string");
+        }
+
+        Value number()
+        {
+            const char* const start = it;
+
+            const auto digits = [this]() {
+                const char* const first = it;
+                while (it != end && *it >= '0' && *it <= '9')
+                    ++it;
+                return it != first;
+            };
+
+            if (it != end && *it == '-')
+                ++it;
+
+            if (it != end && *it == '0')
+                ++it;
+            else if (!digits())
+                fail("invalid number");
+
+            if (it != end && *it == '.') {
+                ++it;
+                if (!digits())
+                    fail("invalid number");
+            }
+
+            if (it != end && (*it == 'e' || *it == 'E')) {
+                ++it;
+                if (it != end && (*it == '+' || *it == '-'))
+                    ++it;
+                if (!digits())
+                    fail("invalid number");
+            }
+
+            return Number{ std::string(start, it) };
+        }
+
+        Value object()
+        {
+            expect('{');
+            Object result;
+
+            skip_whitespace();
+            if (it != end && *it == '}') {
+                ++it;
+                return result;
+            }
+
+            while (true) {
+                skip_whitespace();
+                std::string key;
+                string(key);
+
+                skip_whitespace();
+                expect(':');
+
+                result.data.emplace_back(std::move(key), value());
+
+                skip_whitespace();
+                if (it != end && *it == ',') {
+                    ++it;
+                    continue;
+                }
+
+                expect('}');
+                return result;
+            }
+        }
+
+        Value array()
+        {
+            expect('[');
+            Array result;
+
+            skip_whitespace();
+            if (it != end && *it == ']') {
+                ++it;
+                return result;
+            }
+
+            while (true) {
+                result.data.emplace_back(value());
+
+                skip_whitespace();
+                if (it != end && *it == ',') {
+                    ++it;
+                    continue;
+                }
+
+                expect(']');
+                return result;
+            }
+        }
+
+    public:
+        json_parser(const char* data, std::size_t size) : begin(data), end(data + size), it(data) {}
+
+        Value value()
+        {
+            skip_whitespace();
+            if (it == end)
+                fail("unexpected end of input");
+
+            if (++depth > max_depth)
+                fail("nesting too deep");
+
+            Value result;
+            switch (*it) {
+                case '{':
+                    result = object();
+                    break;
+                case '[':
+                    result = array();
+                    break;
+                case '"': {
+                    String str;
+                    string(str.data);
+                    result = std::move(str);
+                    break;
+                }
+                case 't':
+                    literal("true", 4);
+                    result = True{};
+                    break;
+                case 'f':
+                    literal("false", 5);
+                    result = False{};
+                    break;
+                case 'n':
+                    literal("null", 4);
+                    result = Null{};
+                    break;
+                default:
+                    result = number();
+            }
+
+            --depth;
+            return result;
+        }
+
+        Value document()
+        {
+            Value result = value();
+
+            skip_whitespace();
+            if (it != end)
+                fail("trailing data after document");
+
+            return result;
+        }
+    };
+} // namespace
+
+JsonParseError::JsonParseError(const std::string& msg, std::size_t offset)
+    : std::runtime_error(msg + " at offset " + std::to_string(offset)), offset(offset)
+{
+}
+
+Value so::parse_json(const char* data, std::size_t size)
+{
+    return json_parser(data, size).document();
+}
+
+std::string& so::serialize_json(std::string& out, const Value& obj)
 {
     visit<false>(obj, out);
     return out;
 }
 
-std::ostream& so::serialize_json(std::ostream& out, const Value& obj, packed)
+std::string& so::serialize_json(std::string& out, const Value& obj, packed)
 {
     visit<true>(obj, out);
     return out;
 }
+
+std::ostream& so::serialize_json(std::ostream& out, const Value& obj)
+{
+    std::string buffer;
+    visit<false>(obj, buffer, 0, &out);
+    return out.write(buffer.data(), buffer.size());
+}
+
+std::ostream& so::serialize_json(std::ostream& out, const Value& obj, packed)
+{
+    std::string buffer;
+    visit<true>(obj, buffer, 0, &out);
+    return out.write(buffer.data(), buffer.size());
+}
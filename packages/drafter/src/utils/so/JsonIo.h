@@ -10,6 +10,10 @@
 #define DRAFTER_UTILS_SO_JSONIO_H
 
 #include "Value.h"
+#include <cstddef>
+#include <iosfwd>
+#include <stdexcept>
+#include <string>
 
 namespace drafter
 {
@@ -20,8 +24,42 @@ namespace drafter
             struct packed {
             };
 
+            ///
+            /// Write JSON serialization of given Value to a stream
+            ///
+            /// @remark the serialization is buffered and written in chunks
+            ///     of about 64 KiB, not held whole in memory
+            ///
             std::ostream& serialize_json(std::ostream& out, const Value& obj);
             std::ostream& serialize_json(std::ostream& out, const Value& obj, packed);
+
+            ///
+            /// Append JSON serialization of given Value to a buffer
+            ///
+            /// @remark clear and reuse the buffer between calls to avoid
+            ///     reallocating it
+            ///
+            std::string& serialize_json(std::string& out, const Value& obj);
+            std::string& serialize_json(std::string& out, const Value& obj, packed);
+
+            struct JsonParseError : std::runtime_error {
+                const std::size_t offset; //< position of the offending byte
+
+                JsonParseError(const std::string& msg, std::size_t offset);
+            };
+
+            ///
+            /// Parse a JSON document into a Value
+            ///
+            /// Strings are unescaped straight into their Value, copying runs
+            /// without escapes in bulk; numbers keep their textual form.
+            ///
+            /// @param data     JSON document, not necessarily null terminated
+            /// @param size     length of the document in bytes
+            ///
+            /// @throw JsonParseError if the document is not valid JSON
+            ///
+            Value parse_json(const char* data, std::size_t size);
         }
     }
 }
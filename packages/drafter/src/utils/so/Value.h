@@ -89,7 +89,7 @@ namespace drafter
                 String& operator=(String&&) = default;
                 ~String() = default;
 
-                explicit String(std::string d) : data(d) {}
+                explicit String(std::string d) : data(std::move(d)) {}
             };
 
             struct Number {
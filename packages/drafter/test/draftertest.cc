@@ -11,6 +11,8 @@
 
 #include "stream.h"
 
+#include "refract/SerializeCbor.h"
+#include "refract/TypeQueryVisitor.h"
 #include "refract/SerializeSo.h"
 #include "utils/log/Trivial.h"
 #include "utils/so/JsonIo.h"
@@ -109,6 +111,20 @@ namespace // copied over from header @tjanc
         std::string result(DRAFTER_TEST_FIXTURES);
         return result + name;
     }
+
+    // serialized annotations among the children of a parse result
+    std::string annotationsToJson(const refract::IElement* parseResult)
+    {
+        std::ostringstream out;
+
+        if (auto array = refract::TypeQueryVisitor::as<const refract::ArrayElement>(parseResult)) {
+            for (const auto& item : array->get())
+                if (item->element() == drafter::SerializeKey::Annotation)
+                    drafter::utils::so::serialize_json(out, refract::serialize::renderSo(*item, true));
+        }
+
+        return out.str();
+    }
 }
 
 bool draftertest::handleResultJSON(const std::string& fixturePath, test_options testOpts, bool mustBeOk)
@@ -128,6 +144,36 @@ bool draftertest::handleResultJSON(const std::string& fixturePath, test_options
     if (auto parsed = WrapRefract(blueprint, context)) {
         auto soValue = refract::serialize::renderSo(*parsed, testOpts.test(TEST_OPTION_SOURCEMAPS));
         drafter::utils::so::serialize_json(outStream, soValue);
+
+        // binary serialization must round trip to the very same JSON
+        const auto cbor = refract::serialize::renderCbor(*parsed, testOpts.test(TEST_OPTION_SOURCEMAPS));
+        const auto restored = refract::serialize::parseCbor(cbor.data(), cbor.size());
+
+        std::ostringstream restoredStream;
+        drafter::utils::so::serialize_json(
+            restoredStream, refract::serialize::renderSo(*restored, testOpts.test(TEST_OPTION_SOURCEMAPS)));
+        REQUIRE(restoredStream.str() == outStream.str());
+
+        // so does reading the JSON back
+        const std::string json = outStream.str();
+        const auto reread = refract::serialize::parseSo(drafter::utils::so::parse_json(json.data(), json.size()));
+
+        std::ostringstream rereadStream;
+        drafter::utils::so::serialize_json(
+            rereadStream, refract::serialize::renderSo(*reread, testOpts.test(TEST_OPTION_SOURCEMAPS)));
+        REQUIRE(rereadStream.str() == json);
+
+        // checking reports exactly the annotations of the full conversion
+        if (!testOpts.test(TEST_OPTION_EXPAND_MSON)) {
+            snowcrash::ParseResult<snowcrash::Blueprint> checked;
+            snowcrash::parse(source, snowcrash::ExportSourcemapOption, checked);
+
+            drafter::ConversionContext checkContext(source.c_str());
+            const auto annotations = WrapAnnotations(checked, checkContext);
+
+            REQUIRE(annotationsToJson(annotations.get()) == annotationsToJson(parsed.get()));
+            REQUIRE(checked.report.error.code == blueprint.report.error.code);
+        }
     }
 
     outStream << "\n";
@@ -121,6 +121,59 @@ SCENARIO("`isReserved` identifies reserved type names", "[Element]")
     }
 }
 
+SCENARIO("Elements classify their names as reserved when they are set", "[Element]")
+{
+    GIVEN("a default constructed StringElement")
+    {
+        auto element = make_empty<StringElement>();
+
+        THEN("it is reserved")
+        {
+            REQUIRE(element->reserved());
+        }
+
+        WHEN("it is renamed to a named type")
+        {
+            element->element("Person");
+
+            THEN("it is not reserved")
+            {
+                REQUIRE_FALSE(element->reserved());
+            }
+
+            AND_WHEN("it is cloned")
+            {
+                auto c = element->clone();
+
+                THEN("the clone is not reserved")
+                {
+                    REQUIRE_FALSE(c->reserved());
+                }
+            }
+
+            AND_WHEN("it is renamed to a reserved name")
+            {
+                element->element("object");
+
+                THEN("it is reserved")
+                {
+                    REQUIRE(element->reserved());
+                }
+            }
+        }
+    }
+
+    GIVEN("a default constructed HolderElement")
+    {
+        auto element = make_empty<HolderElement>();
+
+        THEN("it is not reserved")
+        {
+            REQUIRE_FALSE(element->reserved());
+        }
+    }
+}
+
 SCENARIO("Elements can be cloned with refract::clone(const IElement&)", "[Element]")
 {
     GIVEN("An empty BooleanElement")
@@ -0,0 +1,138 @@
+//
+//  test/refract/test-ElementTraits.cc
+//  test-librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "refract/ElementTraits.h"
+#include "refract/Element.h"
+#include "refract/ElementUtils.h"
+#include "refract/JsonSchema.h"
+#include "refract/JsonValue.h"
+#include "utils/so/JsonIo.h"
+
+#include <sstream>
+
+using namespace drafter::utils;
+using namespace refract;
+
+namespace
+{
+    std::string to_string(const so::Value& v)
+    {
+        std::ostringstream ss{};
+        so::serialize_json(ss, v, so::packed{});
+        return ss.str();
+    }
+
+    std::unique_ptr<IElement> makeFixture()
+    {
+        auto emptyWithSample = make_empty<ObjectElement>();
+        addSample(*emptyWithSample,                                                                    //
+            make_element<ObjectElement>(make_element<MemberElement>("status", from_primitive("idle"))) //
+        );
+
+        auto optional = make_element<MemberElement>("note", make_empty<StringElement>());
+        setTypeAttribute(*optional, "optional");
+
+        auto nullable = make_element<MemberElement>("count", make_empty<NumberElement>());
+        setTypeAttribute(*nullable, "nullable");
+
+        auto fixed = make_element<ArrayElement>(from_primitive("a"), make_empty<BooleanElement>());
+        setTypeAttribute(*fixed, "fixed");
+
+        auto extend = make_element<ExtendElement>(std::move(emptyWithSample),
+            make_element<ObjectElement>(make_element<MemberElement>("foo", from_primitive(1))));
+
+        auto el = make_element<ObjectElement>(                   //
+            std::move(extend),                                   //
+            std::move(optional),                                 //
+            std::move(nullable),                                 //
+            make_element<MemberElement>("mid", std::move(fixed)) //
+        );
+        setTypeAttribute(*el, "required");
+
+        return std::move(el);
+    }
+} // namespace
+
+SCENARIO("Element traits reflect type attributes and values", "[traits]")
+{
+    GIVEN("A fixed, nullable StringElement with a default")
+    {
+        auto el = make_empty<StringElement>();
+        setTypeAttribute(*el, "fixed");
+        setTypeAttribute(*el, "nullable");
+        setDefault(*el, from_primitive("foo"));
+
+        WHEN("its traits are queried")
+        {
+            ElementTraitsCache cache;
+            const auto& traits = cache(*el);
+
+            THEN("they match the type attributes")
+            {
+                REQUIRE(traits.fixed == hasFixedTypeAttr(*el));
+                REQUIRE(traits.fixedType == hasFixedTypeTypeAttr(*el));
+                REQUIRE(traits.required == hasRequiredTypeAttr(*el));
+                REQUIRE(traits.optional == hasOptionalTypeAttr(*el));
+                REQUIRE(traits.nullable == hasNullableTypeAttr(*el));
+            }
+
+            THEN("they match the value lookups")
+            {
+                REQUIRE(traits.deflt == findDefault(*el));
+                REQUIRE(traits.firstSample == findFirstSample(*el));
+                REQUIRE(traits.definesValue == definesValue(*el));
+                REQUIRE(traits.inheritsFixed == inheritsFixed(*el));
+            }
+
+            THEN("they are computed once")
+            {
+                REQUIRE(&cache(*el) == &traits);
+            }
+        }
+    }
+
+    GIVEN("An ExtendElement")
+    {
+        auto el = make_element<ExtendElement>(
+            make_element<ObjectElement>(make_element<MemberElement>("foo", from_primitive(1))));
+
+        WHEN("it is merged through the cache twice")
+        {
+            ElementTraitsCache cache;
+            const auto& first = cache.merged(*el);
+            const auto& second = cache.merged(*el);
+
+            THEN("the same merge result is returned")
+            {
+                REQUIRE(&first == &second);
+            }
+        }
+    }
+}
+
+SCENARIO("Generators sharing element traits", "[traits][json-value][json-schema]")
+{
+    GIVEN("An ObjectElement with ExtendElements and type attributes")
+    {
+        const auto el = makeFixture();
+
+        WHEN("a JSON value and a JSON Schema are generated with a shared cache")
+        {
+            ElementTraitsCache traits;
+            auto value = generateJsonValue(*el, traits);
+            auto schema = schema::generateJsonSchema(*el, traits);
+
+            THEN("the results equal those generated separately")
+            {
+                REQUIRE(to_string(value) == to_string(generateJsonValue(*el)));
+                REQUIRE(to_string(schema) == to_string(schema::generateJsonSchema(*el)));
+            }
+        }
+    }
+}
@@ -0,0 +1,132 @@
+//
+//  test/refract/test-ExpandVisitor.cc
+//  test-librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "refract/ExpandVisitor.h"
+#include "refract/Element.h"
+#include "refract/ElementUtils.h"
+#include "refract/Registry.h"
+#include "refract/Utils.h"
+
+using namespace refract;
+
+namespace
+{
+    std::unique_ptr<IElement> expand(const IElement& e)
+    {
+        Registry registry;
+        ExpandVisitor expander(registry);
+        expander(e);
+        return expander.get();
+    }
+
+    template <typename T>
+    std::unique_ptr<T> named(std::unique_ptr<T> e, const std::string& name)
+    {
+        e->element(name);
+        return e;
+    }
+} // namespace
+
+SCENARIO("Expansion skips reserved elements with nothing to expand", "[expand]")
+{
+    GIVEN("an Enum Element with primitive value and enumerations")
+    {
+        auto el = make_element<EnumElement>(from_primitive("red"));
+        el->attributes().set("enumerations", make_element<ArrayElement>(from_primitive("red"), from_primitive(42)));
+
+        THEN("it is not expanded")
+        {
+            REQUIRE(expand(*el) == nullptr);
+        }
+    }
+
+    GIVEN("an empty Array Element")
+    {
+        THEN("it is not expanded")
+        {
+            REQUIRE(expand(*make_empty<ArrayElement>()) == nullptr);
+        }
+    }
+
+    GIVEN("an empty Select Element")
+    {
+        THEN("it is not expanded")
+        {
+            REQUIRE(expand(*make_empty<SelectElement>()) == nullptr);
+        }
+    }
+
+    GIVEN("an empty Member Element")
+    {
+        THEN("it is not expanded")
+        {
+            REQUIRE(expand(*make_empty<MemberElement>()) == nullptr);
+        }
+    }
+}
+
+SCENARIO("Expansion rebuilds the parent of named Holder and Null Elements", "[expand]")
+{
+    GIVEN("an Array Element holding a named Null Element")
+    {
+        auto el = make_element<ArrayElement>(from_primitive("a"), named(make_element<NullElement>(), "Nothing"));
+
+        WHEN("it is expanded")
+        {
+            auto result = expand(*el);
+
+            THEN("it is rebuilt unchanged")
+            {
+                REQUIRE(result);
+                REQUIRE(*result == *el);
+            }
+        }
+    }
+
+    GIVEN("an Object Element with a member holding a named Holder Element")
+    {
+        auto el = make_element<ObjectElement>(
+            make_element<MemberElement>("holder", named(make_element<HolderElement>(from_primitive(1)), "Hold")));
+
+        WHEN("it is expanded")
+        {
+            auto result = expand(*el);
+
+            THEN("it is rebuilt unchanged")
+            {
+                REQUIRE(result);
+                REQUIRE(*result == *el);
+            }
+        }
+    }
+}
+
+SCENARIO("Expansion rebuilds a named Select Element with unexpandable options", "[expand]")
+{
+    GIVEN("a named Select Element with primitive options")
+    {
+        auto el = named(make_element<SelectElement>(), "Choice");
+        el->get().push_back(make_element<OptionElement>(from_primitive("a")));
+        el->get().push_back(make_element<OptionElement>(from_primitive(1), from_primitive(true)));
+
+        WHEN("it is expanded")
+        {
+            auto result = expand(*el);
+
+            THEN("it holds copies of the options")
+            {
+                const auto select = get<const SelectElement>(result.get());
+                REQUIRE(select);
+                REQUIRE(select->get().size() == 2);
+                REQUIRE(*select->get().begin()[0] == *el->get().begin()[0]);
+                REQUIRE(*select->get().begin()[1] == *el->get().begin()[1]);
+            }
+        }
+    }
+}
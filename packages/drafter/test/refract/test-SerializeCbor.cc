@@ -0,0 +1,172 @@
+//
+//  test/refract/test-SerializeCbor.cc
+//  test-librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "refract/SerializeCbor.h"
+#include "refract/Element.h"
+#include "refract/Exception.h"
+#include "refract/SerializeSo.h"
+#include "utils/so/JsonIo.h"
+
+#include <sstream>
+
+using namespace drafter::utils;
+using namespace refract;
+using namespace refract::serialize;
+
+namespace
+{
+    std::string to_json(const IElement& el, bool sourceMaps)
+    {
+        std::ostringstream ss{};
+        so::serialize_json(ss, renderSo(el, sourceMaps), so::packed{});
+        return ss.str();
+    }
+
+    // an element nested in given number of Holder Elements
+    std::unique_ptr<IElement> makeNested(int levels)
+    {
+        std::unique_ptr<IElement> result = make_element<NullElement>();
+        for (int i = 0; i < levels; ++i)
+            result = make_element<HolderElement>(std::move(result));
+        return result;
+    }
+
+    std::unique_ptr<IElement> makeFixture()
+    {
+        auto sourceMap = make_element<ArrayElement>(from_primitive(4), from_primitive(2));
+        sourceMap->element("sourceMap");
+
+        auto name = from_primitive("Ada");
+        name->attributes().set("sourceMap", std::move(sourceMap));
+
+        auto option = make_element<OptionElement>(from_primitive(true), make_empty<NumberElement>());
+
+        auto select = make_element<SelectElement>();
+        select->get().push_back(std::move(option));
+
+        auto extend = make_element<ExtendElement>(make_element<ObjectElement>(), make_empty<ObjectElement>());
+
+        auto result = make_element<ObjectElement>(make_element<MemberElement>("name", std::move(name)),
+            make_element<MemberElement>("tag", make_element<EnumElement>(make_element<NumberElement>("-1.5"))),
+            make_element<MemberElement>("unset", nullptr),
+            make_element<MemberElement>("nothing", make_element<NullElement>()),
+            make_element<MemberElement>("ref", make_element<RefElement>("Person")),
+            make_element<MemberElement>("holder", make_element<HolderElement>(make_empty<StringElement>())),
+            std::move(select),
+            std::move(extend));
+
+        result->element("Person");
+        result->meta().set("id", from_primitive("Person"));
+        return result;
+    }
+} // namespace
+
+SCENARIO("CBOR serialization round trips", "[serialize][cbor]")
+{
+    GIVEN("an element tree holding every kind of element")
+    {
+        const auto fixture = makeFixture();
+
+        WHEN("it is rendered with source maps and restored")
+        {
+            const auto cbor = renderCbor(*fixture, true);
+            const auto restored = parseCbor(cbor.data(), cbor.size());
+
+            THEN("the restored tree serializes to the same JSON")
+            {
+                REQUIRE(restored);
+                REQUIRE(to_json(*restored, true) == to_json(*fixture, true));
+            }
+        }
+
+        WHEN("it is rendered without source maps and restored")
+        {
+            const auto cbor = renderCbor(*fixture, false);
+            const auto restored = parseCbor(cbor.data(), cbor.size());
+
+            THEN("source maps are dropped")
+            {
+                REQUIRE(restored);
+                REQUIRE(to_json(*restored, true) == to_json(*fixture, false));
+            }
+        }
+    }
+}
+
+SCENARIO("CBOR serialization interns element names and keys", "[serialize][cbor]")
+{
+    GIVEN("an array of many elements sharing their name")
+    {
+        auto el = make_element<ArrayElement>();
+        for (int i = 0; i < 100; ++i)
+            el->get().push_back(make_element<StringElement>("value"));
+
+        WHEN("it is rendered")
+        {
+            const auto cbor = renderCbor(*el, false);
+
+            THEN("the name is stored once")
+            {
+                REQUIRE(cbor.find("string") == cbor.rfind("string"));
+            }
+        }
+    }
+}
+
+SCENARIO("CBOR deserialization rejects malformed input", "[serialize][cbor]")
+{
+    const auto cbor = renderCbor(*makeFixture(), false);
+
+    GIVEN("a truncated document")
+    {
+        THEN("it throws")
+        {
+            REQUIRE_THROWS_AS(parseCbor(cbor.data(), cbor.size() - 1), DeserializationError);
+            REQUIRE_THROWS_AS(parseCbor(cbor.data(), 0), DeserializationError);
+        }
+    }
+
+    GIVEN("a document followed by trailing data")
+    {
+        const auto extended = cbor + '\0';
+
+        THEN("it throws")
+        {
+            REQUIRE_THROWS_AS(parseCbor(extended.data(), extended.size()), DeserializationError);
+        }
+    }
+
+    GIVEN("a document without the self-describe tag")
+    {
+        THEN("it throws")
+        {
+            REQUIRE_THROWS_AS(parseCbor(cbor.data() + 3, cbor.size() - 3), DeserializationError);
+        }
+    }
+
+    GIVEN("a document nesting elements deeper than 4096 levels")
+    {
+        const auto deep = renderCbor(*makeNested(4096), false);
+
+        THEN("it throws")
+        {
+            REQUIRE_THROWS_AS(parseCbor(deep.data(), deep.size()), DeserializationError);
+        }
+    }
+
+    GIVEN("a document nesting elements 4096 levels deep")
+    {
+        const auto deep = renderCbor(*makeNested(4095), false);
+
+        THEN("it parses")
+        {
+            REQUIRE(parseCbor(deep.data(), deep.size()));
+        }
+    }
+}
@@ -0,0 +1,108 @@
+//
+//  test/refract/test-SerializeSo.cc
+//  test-librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "refract/SerializeSo.h"
+#include "refract/Element.h"
+#include "refract/ElementUtils.h"
+#include "refract/Exception.h"
+#include "utils/so/JsonIo.h"
+
+using namespace drafter::utils;
+using namespace refract;
+using namespace refract::serialize;
+
+namespace
+{
+    std::unique_ptr<IElement> parse(const std::string& json)
+    {
+        return parseSo(so::parse_json(json.data(), json.size()));
+    }
+
+    std::string render(const IElement& el)
+    {
+        std::string buffer;
+        so::serialize_json(buffer, renderSo(el, true), so::packed{});
+        return buffer;
+    }
+} // namespace
+
+SCENARIO("Simple Objects are deserialized into API Elements", "[serialize][simple-object]")
+{
+    GIVEN("a named type holding members, a mixin and an empty value")
+    {
+        const std::string json = R"({"element":"Person","meta":{"id":{"element":"string","content":"Person"}},)"
+                                 R"("content":[{"element":"ref","content":"Base"},)"
+                                 R"({"element":"member","content":{"key":{"element":"string","content":"age"},)"
+                                 R"("value":{"element":"number","content":42.0}}},)"
+                                 R"({"element":"member","content":{"key":{"element":"string","content":"unset"}}},)"
+                                 R"({"element":"Custom"}]})";
+
+        WHEN("it is deserialized")
+        {
+            const auto el = parse(json);
+
+            THEN("the named type is an Object Element")
+            {
+                const auto* obj = get<const ObjectElement>(el.get());
+                REQUIRE(obj);
+                REQUIRE(obj->element() == "Person");
+                REQUIRE(obj->get().size() == 4);
+            }
+
+            THEN("base Elements get their own DSD")
+            {
+                const auto* obj = get<const ObjectElement>(el.get());
+                REQUIRE(obj);
+                REQUIRE(get<const RefElement>(obj->get().begin()[0].get()));
+                REQUIRE(get<const MemberElement>(obj->get().begin()[1].get()));
+            }
+
+            THEN("it renders back into the same JSON")
+            {
+                REQUIRE(render(*el) == json);
+            }
+        }
+    }
+
+    GIVEN("a named type holding a single Element")
+    {
+        const std::string json = R"({"element":"dataStructure","content":{"element":"boolean","content":true}})";
+
+        WHEN("it is deserialized")
+        {
+            const auto el = parse(json);
+
+            THEN("it is a Holder Element")
+            {
+                REQUIRE(get<const HolderElement>(el.get()));
+                REQUIRE(render(*el) == json);
+            }
+        }
+    }
+
+    GIVEN("values not representing API Elements")
+    {
+        const std::string invalid[] = {
+            R"([])",
+            R"({"content":"no name"})",
+            R"({"element":"string","content":5})",
+            R"({"element":"member","content":{"value":{"element":"null"}}})",
+            R"({"element":"select","content":[{"element":"string"}]})",
+            R"({"element":"string","unknown":true})",
+        };
+
+        THEN("deserializing them throws")
+        {
+            for (const auto& json : invalid) {
+                INFO(json);
+                REQUIRE_THROWS_AS(parse(json), DeserializationError);
+            }
+        }
+    }
+}
@@ -210,6 +210,173 @@ int test_parse_to_string_skip_body_schema_gen()
     free(result);
 }
 
+char* parse_and_serialize_with(drafter_parser* parser, const char* blueprint)
+{
+    drafter_result* result = NULL;
+    char* out = NULL;
+
+    if (parser)
+        drafter_parser_parse_blueprint(parser, blueprint, &result, NULL);
+    else
+        drafter_parse_blueprint(blueprint, &result, NULL);
+
+    out = drafter_serialize(result, NULL);
+    drafter_free_result(result);
+
+    return out;
+}
+
+int test_reusable_parser()
+{
+    const char* blueprints[] = { source, source_warning, apib_with_attrs_no_body_nor_schema, source };
+    drafter_parser* parser = drafter_init_parser();
+    drafter_result* result = NULL;
+    size_t i = 0;
+
+    REQUIRE(parser);
+
+    for (i = 0; i < sizeof blueprints / sizeof blueprints[0]; ++i) {
+        char* reused = parse_and_serialize_with(parser, blueprints[i]);
+        char* fresh = parse_and_serialize_with(NULL, blueprints[i]);
+
+        REQUIRE(reused);
+        REQUIRE(fresh);
+        REQUIRE(strcmp(reused, fresh) == 0);
+
+        free(reused);
+        free(fresh);
+    }
+
+    REQUIRE(drafter_parser_check_blueprint(parser, source_warning, &result, NULL) == 0);
+    REQUIRE(result);
+    drafter_free_result(result);
+
+    REQUIRE(drafter_parser_parse_blueprint(NULL, source, NULL, NULL) == DRAFTER_EINVALID_INPUT);
+    REQUIRE(drafter_parser_parse_blueprint(parser, NULL, NULL, NULL) == DRAFTER_EINVALID_INPUT);
+
+    drafter_free_parser(parser);
+    return 0;
+}
+
+int test_parse_of_given_length()
+{
+    const size_t len = strlen(source);
+    char* unterminated = (char*)malloc(len + 1);
+    drafter_result* result = NULL;
+    char* expected_out = parse_and_serialize_with(NULL, source);
+    char* out = NULL;
+
+    memcpy(unterminated, source, len);
+    unterminated[len] = '#'; /* must not be read */
+
+    REQUIRE(drafter_parse_blueprint_n(unterminated, len, &result, NULL) == 0);
+    REQUIRE(result);
+
+    out = drafter_serialize(result, NULL);
+    REQUIRE(out);
+    REQUIRE(strcmp(out, expected_out) == 0);
+
+    REQUIRE(drafter_parse_blueprint_n(NULL, 1, NULL, NULL) == DRAFTER_EINVALID_INPUT);
+    REQUIRE(drafter_parse_blueprint_n(NULL, 0, NULL, NULL) == DRAFTER_OK);
+
+    drafter_free_result(result);
+    free(out);
+    free(expected_out);
+    free(unterminated);
+    return 0;
+}
+
+struct collected_output {
+    char* data;
+    size_t size;
+    unsigned chunks;
+    int refuse;
+};
+
+int collect_output(void* ctx, const char* data, size_t size)
+{
+    struct collected_output* collected = (struct collected_output*)ctx;
+
+    if (collected->refuse)
+        return 1;
+
+    collected->data = (char*)realloc(collected->data, collected->size + size + 1);
+    memcpy(collected->data + collected->size, data, size);
+    collected->size += size;
+    collected->data[collected->size] = '\0';
+    ++collected->chunks;
+    return 0;
+}
+
+int test_serialize_to_callback()
+{
+    const size_t len = strlen(source);
+    drafter_result* result = NULL;
+    drafter_result* annotations = NULL;
+    drafter_serialize_options* options = drafter_init_serialize_options();
+    struct collected_output collected = { NULL, 0, 0, 0 };
+    size_t written = 0;
+    size_t expected_size = 0;
+    char* expected = NULL;
+
+    REQUIRE(drafter_parse_blueprint_n(source, len, &result, NULL) == 0);
+    REQUIRE(drafter_check_blueprint_n(source, len, &annotations, NULL) == 0);
+    REQUIRE(!annotations);
+
+    /* YAML is passed on while being written */
+    expected = drafter_serialize_n(result, NULL, &expected_size);
+    REQUIRE(drafter_serialize_write(result, NULL, collect_output, &collected, &written) == DRAFTER_OK);
+    REQUIRE(written == expected_size);
+    REQUIRE(collected.size == expected_size);
+    REQUIRE(memcmp(collected.data, expected, expected_size) == 0);
+    free(expected);
+    free(collected.data);
+
+    /* so is JSON */
+    drafter_set_format(options, DRAFTER_SERIALIZE_JSON);
+    collected.data = NULL;
+    collected.size = 0;
+    collected.chunks = 0;
+
+    expected = drafter_serialize_n(result, options, &expected_size);
+    REQUIRE(drafter_serialize_write(result, options, collect_output, &collected, &written) == DRAFTER_OK);
+    REQUIRE(written == expected_size);
+    REQUIRE(collected.size == expected_size);
+    REQUIRE(memcmp(collected.data, expected, expected_size) == 0);
+    free(expected);
+    free(collected.data);
+
+    drafter_set_format(options, DRAFTER_SERIALIZE_CBOR);
+    collected.data = NULL;
+    collected.size = 0;
+    collected.chunks = 0;
+
+    expected = drafter_serialize_n(result, options, &expected_size);
+    REQUIRE(drafter_serialize_write(result, options, collect_output, &collected, &written) == DRAFTER_OK);
+    REQUIRE(written == expected_size);
+    REQUIRE(collected.size == expected_size);
+    REQUIRE(memcmp(collected.data, expected, expected_size) == 0);
+    free(expected);
+    free(collected.data);
+
+    /* a sink may stop the serialization */
+    collected.data = NULL;
+    collected.size = 0;
+    collected.chunks = 0;
+    collected.refuse = 1;
+
+    drafter_set_format(options, DRAFTER_SERIALIZE_YAML);
+    REQUIRE(drafter_serialize_write(result, options, collect_output, &collected, &written) == DRAFTER_EINVALID_OUTPUT);
+    REQUIRE(written == 0);
+
+    REQUIRE(drafter_serialize_write(result, options, NULL, NULL, NULL) == DRAFTER_EINVALID_INPUT);
+    REQUIRE(drafter_serialize_write(NULL, options, collect_output, &collected, NULL) == DRAFTER_EINVALID_INPUT);
+
+    drafter_free_serialize_options(options);
+    drafter_free_result(result);
+    return 0;
+}
+
 int main()
 {
     REQUIRE(test_parse_and_serialize() == 0);
@@ -222,6 +389,9 @@ int main()
     REQUIRE(test_blueprint_to_elements_default() == 0);
     test_parse_to_string_skip_body_gen();
     test_parse_to_string_skip_body_schema_gen();
+    REQUIRE(test_reusable_parser() == 0);
+    REQUIRE(test_parse_of_given_length() == 0);
+    REQUIRE(test_serialize_to_callback() == 0);
 
     return 0;
 }
@@ -0,0 +1,200 @@
+//
+//  test-Cancellation.cc
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "drafter.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+    const char* source =
+        "FORMAT: 1A\n"
+        "\n"
+        "# Cancellation\n"
+        "\n"
+        "# Group Users\n"
+        "\n"
+        "## User [/users/{id}]\n"
+        "\n"
+        "### Retrieve [GET]\n"
+        "\n"
+        "+ Response 200 (application/json)\n"
+        "    + Attributes\n"
+        "        + id: 42 (number)\n"
+        "\n"
+        "# Group Notes\n"
+        "\n"
+        "## Note [/notes/{id}]\n"
+        "\n"
+        "### Retrieve [GET]\n"
+        "\n"
+        "+ Response 200 (application/json)\n"
+        "    + Attributes\n"
+        "        + text: hello\n"
+        "\n"
+        "+ Response 404\n";
+
+    struct Report {
+        drafter_progress_stage stage;
+        size_t done;
+        size_t total;
+    };
+
+    struct Recorder {
+        std::vector<Report> reports;
+        drafter_progress_stage cancelAt = DRAFTER_PROGRESS_PARSING;
+        size_t cancelAfter = static_cast<size_t>(-1);
+    };
+
+    int record(void* ctx, drafter_progress_stage stage, size_t done, size_t total)
+    {
+        auto& recorder = *static_cast<Recorder*>(ctx);
+        recorder.reports.push_back(Report{ stage, done, total });
+
+        return (stage == recorder.cancelAt && recorder.reports.size() > recorder.cancelAfter) ? 1 : 0;
+    }
+
+    // cancels once parsing is complete, before anything is converted
+    int cancelParsed(void* ctx, drafter_progress_stage stage, size_t done, size_t total)
+    {
+        auto& recorder = *static_cast<Recorder*>(ctx);
+        recorder.reports.push_back(Report{ stage, done, total });
+
+        return (stage == DRAFTER_PROGRESS_PARSING && done == total) ? 1 : 0;
+    }
+
+    drafter_error parse(const drafter_parse_options* options, drafter_result** result)
+    {
+        *result = nullptr;
+        return drafter_parse_blueprint(source, result, options);
+    }
+} // namespace
+
+TEST_CASE("Progress is reported through parsing, then conversion", "[cancellation]")
+{
+    Recorder recorder;
+
+    drafter_parse_options* options = drafter_init_parse_options();
+    drafter_set_progress(options, record, &recorder);
+
+    drafter_result* result = nullptr;
+    REQUIRE(parse(options, &result) == DRAFTER_OK);
+    REQUIRE(result);
+
+    drafter_result* expected = nullptr;
+    REQUIRE(parse(nullptr, &expected) == DRAFTER_OK);
+
+    char* serialized = drafter_serialize(result, nullptr);
+    char* serializedExpected = drafter_serialize(expected, nullptr);
+    REQUIRE(std::strcmp(serialized, serializedExpected) == 0);
+
+    REQUIRE(recorder.reports.size() > 4);
+    REQUIRE(recorder.reports.front().stage == DRAFTER_PROGRESS_PARSING);
+    REQUIRE(recorder.reports.back().stage == DRAFTER_PROGRESS_CONVERTING);
+    REQUIRE(recorder.reports.back().done == std::strlen(source));
+
+    for (size_t i = 1; i < recorder.reports.size(); ++i) {
+        const Report& previous = recorder.reports[i - 1];
+        const Report& report = recorder.reports[i];
+
+        REQUIRE(report.total == std::strlen(source));
+        REQUIRE(report.done <= report.total);
+        REQUIRE(report.stage >= previous.stage);
+
+        if (report.stage == previous.stage)
+            REQUIRE(report.done >= previous.done);
+    }
+
+    free(serialized);
+    free(serializedExpected);
+    drafter_free_result(result);
+    drafter_free_result(expected);
+    drafter_free_parse_options(options);
+}
+
+TEST_CASE("Cancelled parses return no result", "[cancellation]")
+{
+    drafter_parse_options* options = drafter_init_parse_options();
+    drafter_result* result = nullptr;
+
+    SECTION("by a token cancelled beforehand")
+    {
+        drafter_cancel_token* token = drafter_init_cancel_token();
+        drafter_set_cancel_token(options, token);
+
+        REQUIRE(parse(options, &result) == DRAFTER_OK);
+        drafter_free_result(result);
+
+        drafter_cancel(token);
+
+        REQUIRE(parse(options, &result) == DRAFTER_ECANCELLED);
+        REQUIRE(!result);
+
+        REQUIRE(drafter_check_blueprint(source, &result, options) == DRAFTER_ECANCELLED);
+        REQUIRE(!result);
+
+        drafter_free_cancel_token(token);
+    }
+
+    SECTION("by the progress callback while parsing")
+    {
+        Recorder recorder;
+        recorder.cancelAt = DRAFTER_PROGRESS_PARSING;
+        recorder.cancelAfter = 1;
+        drafter_set_progress(options, record, &recorder);
+
+        REQUIRE(parse(options, &result) == DRAFTER_ECANCELLED);
+        REQUIRE(!result);
+        REQUIRE(recorder.reports.size() == 2);
+    }
+
+    SECTION("by the progress callback at the end of parsing")
+    {
+        Recorder recorder;
+        drafter_set_progress(options, cancelParsed, &recorder);
+
+        REQUIRE(parse(options, &result) == DRAFTER_ECANCELLED);
+        REQUIRE(!result);
+        REQUIRE(!recorder.reports.empty());
+        REQUIRE(recorder.reports.back().stage == DRAFTER_PROGRESS_PARSING);
+        REQUIRE(recorder.reports.back().done == std::strlen(source));
+
+        for (const auto& report : recorder.reports)
+            REQUIRE(report.stage == DRAFTER_PROGRESS_PARSING);
+    }
+
+    SECTION("by the progress callback while converting")
+    {
+        Recorder recorder;
+        recorder.cancelAt = DRAFTER_PROGRESS_CONVERTING;
+        recorder.cancelAfter = 0;
+        drafter_set_progress(options, record, &recorder);
+
+        REQUIRE(parse(options, &result) == DRAFTER_ECANCELLED);
+        REQUIRE(!result);
+        REQUIRE(recorder.reports.back().stage == DRAFTER_PROGRESS_CONVERTING);
+    }
+
+    SECTION("by the progress callback while sections are converted concurrently")
+    {
+        Recorder recorder;
+        recorder.cancelAt = DRAFTER_PROGRESS_CONVERTING;
+        recorder.cancelAfter = 0;
+        drafter_set_progress(options, record, &recorder);
+        drafter_set_concurrency(options, 4);
+
+        REQUIRE(parse(options, &result) == DRAFTER_ECANCELLED);
+        REQUIRE(!result);
+    }
+
+    drafter_free_parse_options(options);
+}
@@ -0,0 +1,261 @@
+//
+//  test-Concurrency.cc
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "drafter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    const char* source =
+        "FORMAT: 1A\n"
+        "\n"
+        "# Concurrency\n"
+        "\n"
+        "## Data Structures\n"
+        "\n"
+        "### User (object)\n"
+        "+ id: 42 (number, required)\n"
+        "+ name: Ada (string)\n"
+        "+ role (enum)\n"
+        "    + admin\n"
+        "    + guest\n"
+        "\n"
+        "### Admin (User)\n"
+        "+ permissions (array[string])\n"
+        "\n"
+        "## Users [/users/{id}]\n"
+        "\n"
+        "+ Parameters\n"
+        "    + id: 42 (number) - user id\n"
+        "\n"
+        "### Retrieve a user [GET]\n"
+        "\n"
+        "+ Response 200 (application/json)\n"
+        "    + Attributes (Admin)\n"
+        "\n"
+        "+ Response 404 (application/json)\n"
+        "\n"
+        "        { \"message\": \"not found\" }\n"
+        "\n"
+        "### Update a user [PATCH]\n"
+        "\n"
+        "+ Request (application/json)\n"
+        "    + Attributes (User)\n"
+        "\n"
+        "+ Response 204\n";
+
+    constexpr unsigned Threads = 8;
+    constexpr unsigned Iterations = 25;
+
+    std::string parse(const drafter_serialize_options* serializeOptions)
+    {
+        char* out = nullptr;
+        const drafter_error status = drafter_parse_blueprint_to(source, &out, nullptr, serializeOptions);
+
+        std::string result = std::to_string(status) + "\n";
+        if (out)
+            result += out;
+
+        free(out);
+        return result;
+    }
+
+    std::string parse(const char* blueprint,
+        const drafter_parse_options* parseOptions,
+        const drafter_serialize_options* serializeOptions)
+    {
+        char* out = nullptr;
+        const drafter_error status = drafter_parse_blueprint_to(blueprint, &out, parseOptions, serializeOptions);
+
+        std::string result = std::to_string(status) + "\n";
+        if (out)
+            result += out;
+
+        free(out);
+        return result;
+    }
+
+    std::string parse(drafter_parser* parser, const drafter_serialize_options* serializeOptions)
+    {
+        drafter_result* parsed = nullptr;
+        const drafter_error status = drafter_parser_parse_blueprint(parser, source, &parsed, nullptr);
+
+        std::string result = std::to_string(status) + "\n";
+        if (char* out = drafter_serialize(parsed, serializeOptions)) {
+            result += out;
+            free(out);
+        }
+
+        drafter_free_result(parsed);
+        return result;
+    }
+} // namespace
+
+TEST_CASE("Concurrent parses produce the same results as sequential ones", "[concurrency]")
+{
+    drafter_serialize_options* serializeOptions = drafter_init_serialize_options();
+    drafter_set_format(serializeOptions, DRAFTER_SERIALIZE_JSON);
+    drafter_set_sourcemaps_included(serializeOptions);
+
+    const std::string expected = parse(serializeOptions);
+    REQUIRE(expected.find("\"dataStructure\"") != std::string::npos);
+
+    std::atomic<unsigned> mismatches{ 0 };
+    std::vector<std::thread> threads;
+
+    // all threads share the options, as a server would
+    for (unsigned i = 0; i < Threads; ++i)
+        threads.emplace_back([&]() {
+            for (unsigned j = 0; j < Iterations; ++j)
+                if (parse(serializeOptions) != expected)
+                    ++mismatches;
+        });
+
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(mismatches == 0);
+
+    drafter_free_serialize_options(serializeOptions);
+}
+
+TEST_CASE("Reusable parsers may be used by one thread each", "[concurrency]")
+{
+    drafter_serialize_options* serializeOptions = drafter_init_serialize_options();
+    drafter_set_format(serializeOptions, DRAFTER_SERIALIZE_JSON);
+    drafter_set_sourcemaps_included(serializeOptions);
+
+    const std::string expected = parse(serializeOptions);
+
+    std::atomic<unsigned> mismatches{ 0 };
+    std::vector<std::thread> threads;
+
+    for (unsigned i = 0; i < Threads; ++i)
+        threads.emplace_back([&]() {
+            drafter_parser* parser = drafter_init_parser();
+            for (unsigned j = 0; j < Iterations; ++j)
+                if (parse(parser, serializeOptions) != expected)
+                    ++mismatches;
+            drafter_free_parser(parser);
+        });
+
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(mismatches == 0);
+
+    drafter_free_serialize_options(serializeOptions);
+}
+
+TEST_CASE("Concurrent checks and serializations share no state", "[concurrency]")
+{
+    drafter_result* reference = nullptr;
+    REQUIRE(drafter_parse_blueprint(source, &reference, nullptr) >= DRAFTER_OK);
+
+    char* expected = drafter_serialize(reference, nullptr);
+    REQUIRE(expected);
+
+    std::atomic<unsigned> mismatches{ 0 };
+    std::vector<std::thread> threads;
+
+    for (unsigned i = 0; i < Threads; ++i)
+        threads.emplace_back([&, i]() {
+            for (unsigned j = 0; j < Iterations; ++j) {
+                if (i % 2) {
+                    // results may be read by several threads at once
+                    char* serialized = drafter_serialize(reference, nullptr);
+                    if (!serialized || std::string(serialized) != expected)
+                        ++mismatches;
+                    free(serialized);
+                } else {
+                    drafter_result* annotations = nullptr;
+                    if (drafter_check_blueprint(source, &annotations, nullptr) < DRAFTER_OK)
+                        ++mismatches;
+                    drafter_free_result(annotations);
+                }
+            }
+        });
+
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(mismatches == 0);
+
+    free(expected);
+    drafter_free_result(reference);
+}
+
+TEST_CASE("Concurrent conversion of top-level sections matches the sequential one", "[concurrency]")
+{
+    const char* sections =
+        "FORMAT: 1A\n"
+        "\n"
+        "# Sections\n"
+        "\n"
+        "# Group Users\n"
+        "\n"
+        "## User [/users/{id}]\n"
+        "\n"
+        "### Retrieve [GET]\n"
+        "\n"
+        "+ Response 200 (application/json)\n"
+        "    + Attributes (Person)\n"
+        "\n"
+        "# Data Structures\n"
+        "\n"
+        "## Person (object)\n"
+        "+ name: Ada (string)\n"
+        "+ pet (Pet)\n"
+        "\n"
+        "## Pet (object)\n"
+        "+ kind (enum[string])\n"
+        "    + dog\n"
+        "    + cat\n"
+        "\n"
+        "# Group Pets\n"
+        "\n"
+        "## Pets [/pets]\n"
+        "\n"
+        "### List [GET]\n"
+        "\n"
+        "+ Response 200 (application/json)\n"
+        "    + Attributes (array[Pet])\n"
+        "\n"
+        "### Create [POST]\n"
+        "\n"
+        "+ Request (application/json)\n"
+        "    + Attributes (Unknown)\n"
+        "\n"
+        "+ Response 201\n";
+
+    drafter_serialize_options* serializeOptions = drafter_init_serialize_options();
+    drafter_set_format(serializeOptions, DRAFTER_SERIALIZE_JSON);
+    drafter_set_sourcemaps_included(serializeOptions);
+
+    drafter_parse_options* parseOptions = drafter_init_parse_options();
+
+    for (const char* blueprint : { source, sections }) {
+        const std::string expected = parse(blueprint, parseOptions, serializeOptions);
+
+        for (unsigned threads : { 2u, 3u, 16u }) {
+            drafter_set_concurrency(parseOptions, threads);
+            REQUIRE(parse(blueprint, parseOptions, serializeOptions) == expected);
+        }
+
+        drafter_set_concurrency(parseOptions, 0);
+    }
+
+    drafter_free_parse_options(parseOptions);
+    drafter_free_serialize_options(serializeOptions);
+}
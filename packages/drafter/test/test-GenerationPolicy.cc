@@ -0,0 +1,157 @@
+//
+//  test-GenerationPolicy.cc
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "drafter.h"
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace
+{
+    const char* source =
+        "FORMAT: 1A\n"
+        "\n"
+        "# Generation\n"
+        "\n"
+        "## Users [/users]\n"
+        "\n"
+        "### Create a user [POST]\n"
+        "\n"
+        "+ Request (application/json)\n"
+        "    + Attributes\n"
+        "        + name: Ada\n"
+        "\n"
+        "+ Response 201 (application/json)\n"
+        "    + Attributes\n"
+        "        + id: 42 (number)\n"
+        "\n"
+        "+ Response 400 (application/json)\n"
+        "    + Attributes\n"
+        "        + message: invalid\n";
+
+    struct Call {
+        drafter_gen_asset asset;
+        std::string method;
+        unsigned status;
+        std::string mediaType;
+    };
+
+    // schemas only for responses, bodies only for 2xx responses
+    int policy(void* ctx, drafter_gen_asset asset, const char* method, unsigned int status, const char* media_type)
+    {
+        static_cast<std::vector<Call>*>(ctx)->push_back(Call{ asset, method, status, media_type });
+
+        if (asset == DRAFTER_GEN_BODY_SCHEMA)
+            return status != 0;
+
+        return status >= 200 && status < 300;
+    }
+
+    int none(void*, drafter_gen_asset, const char*, unsigned int, const char*)
+    {
+        return 0;
+    }
+
+    std::string parse(const drafter_parse_options* options, drafter_error* status = nullptr)
+    {
+        drafter_serialize_options* serializeOptions = drafter_init_serialize_options();
+        drafter_set_format(serializeOptions, DRAFTER_SERIALIZE_JSON);
+
+        char* out = nullptr;
+        const drafter_error result = drafter_parse_blueprint_to(source, &out, options, serializeOptions);
+
+        if (status)
+            *status = result;
+
+        std::string serialized = out ? out : "";
+
+        free(out);
+        drafter_free_serialize_options(serializeOptions);
+        return serialized;
+    }
+
+    std::size_t count(const std::string& haystack, const std::string& needle)
+    {
+        std::size_t result = 0;
+        for (auto pos = haystack.find(needle); pos != std::string::npos; pos = haystack.find(needle, pos + 1))
+            ++result;
+        return result;
+    }
+} // namespace
+
+TEST_CASE("Generation policy selects generated assets per payload", "[generation policy]")
+{
+    std::vector<Call> calls;
+
+    drafter_parse_options* options = drafter_init_parse_options();
+    drafter_set_gen_policy(options, policy, &calls);
+
+    const std::string unrestricted = parse(nullptr);
+    REQUIRE(count(unrestricted, "\"messageBody\"") == 3);
+    REQUIRE(count(unrestricted, "\"messageBodySchema\"") == 3);
+
+    const std::string restricted = parse(options);
+    REQUIRE(count(restricted, "\"messageBody\"") == 1);
+    REQUIRE(count(restricted, "\"messageBodySchema\"") == 2);
+
+    REQUIRE(calls.size() == 6);
+
+    for (const auto& call : calls) {
+        REQUIRE(call.method == "POST");
+        REQUIRE(call.mediaType == "application/json");
+    }
+
+    REQUIRE(calls[0].status == 0);
+    REQUIRE(calls[2].status == 201);
+    REQUIRE(calls[4].status == 400);
+
+    drafter_free_parse_options(options);
+}
+
+TEST_CASE("Generation policy combines with skip options", "[generation policy]")
+{
+    std::vector<Call> calls;
+
+    drafter_parse_options* options = drafter_init_parse_options();
+    drafter_set_gen_policy(options, policy, &calls);
+    drafter_set_skip_gen_body_schemas(options);
+
+    const std::string result = parse(options);
+    REQUIRE(count(result, "\"messageBody\"") == 1);
+    REQUIRE(count(result, "\"messageBodySchema\"") == 0);
+
+    // skipped assets are not asked for
+    for (const auto& call : calls)
+        REQUIRE(call.asset == DRAFTER_GEN_BODY);
+
+    drafter_free_parse_options(options);
+}
+
+TEST_CASE("Attributes of payloads the policy declines are not expanded", "[generation policy]")
+{
+    drafter_parse_options* options = drafter_init_parse_options();
+
+    // any expansion exceeds the limit
+    drafter_set_limits(options, 0, 1, 0, 0);
+
+    drafter_error status = DRAFTER_OK;
+    parse(options, &status);
+    REQUIRE(status == static_cast<drafter_error>(5));
+
+    drafter_set_gen_policy(options, none, nullptr);
+
+    const std::string result = parse(options, &status);
+    REQUIRE(status == DRAFTER_OK);
+    REQUIRE(count(result, "\"messageBody\"") == 0);
+    REQUIRE(count(result, "\"messageBodySchema\"") == 0);
+    REQUIRE(count(result, "\"dataStructure\"") == 3);
+
+    drafter_free_parse_options(options);
+}
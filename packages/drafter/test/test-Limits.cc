@@ -0,0 +1,251 @@
+//
+//  test-Limits.cc
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "drafter.h"
+#include "../src/ConversionBudget.h"
+#include "refract/Element.h"
+#include "refract/JsonSchema.h"
+#include "refract/JsonValue.h"
+#include "SourceAnnotation.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <string>
+
+using namespace drafter;
+
+namespace
+{
+    // every level doubles the expanded attributes
+    std::string doublingBlueprint(unsigned levels)
+    {
+        std::string result = "FORMAT: 1A\n\n# Limits\n\n## Data Structures\n\n### Level0 (object)\n+ a: x\n+ b: y\n";
+
+        for (unsigned i = 1; i <= levels; ++i) {
+            const std::string lower = "Level" + std::to_string(i - 1);
+            result += "\n### Level" + std::to_string(i) + " (object)\n";
+            result += "+ p (" + lower + ")\n";
+            result += "+ q (" + lower + ")\n";
+        }
+
+        result += "\n## Resource [/resource]\n\n### Retrieve [GET]\n\n+ Response 200 (application/json)\n";
+        result += "    + Attributes (Level" + std::to_string(levels) + ")\n";
+
+        return result;
+    }
+
+    struct Parse {
+        drafter_error status;
+        std::string out;
+    };
+
+    Parse parse(const std::string& blueprint, const drafter_parse_options* parseOptions)
+    {
+        drafter_serialize_options* serializeOptions = drafter_init_serialize_options();
+        drafter_set_format(serializeOptions, DRAFTER_SERIALIZE_JSON);
+
+        char* out = nullptr;
+        Parse result{ drafter_parse_blueprint_to(blueprint.c_str(), &out, parseOptions, serializeOptions), {} };
+
+        if (out)
+            result.out = out;
+
+        free(out);
+        drafter_free_serialize_options(serializeOptions);
+        return result;
+    }
+
+    Parse check(const std::string& blueprint, const drafter_parse_options* parseOptions)
+    {
+        drafter_result* annotations = nullptr;
+        Parse result{ drafter_check_blueprint(blueprint.c_str(), &annotations, parseOptions), {} };
+
+        if (annotations) {
+            char* out = drafter_serialize(annotations, nullptr);
+            result.out = out;
+            free(out);
+        }
+
+        drafter_free_result(annotations);
+        return result;
+    }
+
+    const drafter_error LimitExceeded = static_cast<drafter_error>(snowcrash::LimitError);
+} // namespace
+
+TEST_CASE("Documents within limits parse as without them", "[limits]")
+{
+    const std::string blueprint = doublingBlueprint(8);
+
+    drafter_parse_options* options = drafter_init_parse_options();
+    drafter_set_limits(options, 1000, 1000000, 100000000, 60000);
+
+    const Parse unlimited = parse(blueprint, nullptr);
+    const Parse limited = parse(blueprint, options);
+
+    REQUIRE(unlimited.status == DRAFTER_OK);
+    REQUIRE(limited.status == DRAFTER_OK);
+    REQUIRE(limited.out == unlimited.out);
+
+    drafter_free_parse_options(options);
+}
+
+TEST_CASE("Exceeding a limit ends the parse with an error annotation", "[limits]")
+{
+    const std::string blueprint = doublingBlueprint(12);
+
+    drafter_parse_options* options = drafter_init_parse_options();
+
+    SECTION("expansion depth")
+    {
+        drafter_set_limits(options, 8, 0, 0, 0);
+
+        const Parse result = parse(blueprint, options);
+        REQUIRE(result.status == LimitExceeded);
+        REQUIRE(result.out.find("data structure expansion nests deeper than 8 elements") != std::string::npos);
+    }
+
+    SECTION("expanded elements")
+    {
+        drafter_set_limits(options, 0, 1000, 0, 0);
+
+        const Parse result = parse(blueprint, options);
+        REQUIRE(result.status == LimitExceeded);
+        REQUIRE(result.out.find("data structures expand into too many elements") != std::string::npos);
+    }
+
+    SECTION("expanded elements, converted concurrently")
+    {
+        drafter_set_limits(options, 0, 1000, 0, 0);
+        drafter_set_concurrency(options, 4);
+
+        const Parse result = parse(blueprint, options);
+        REQUIRE(result.status == LimitExceeded);
+        REQUIRE(result.out.find("data structures expand into too many elements") != std::string::npos);
+    }
+
+    SECTION("generated asset size")
+    {
+        drafter_set_limits(options, 0, 0, 1024, 0);
+
+        const Parse result = parse(blueprint, options);
+        REQUIRE(result.status == LimitExceeded);
+        REQUIRE(result.out.find("generated asset exceeds 1024 bytes") != std::string::npos);
+    }
+
+    drafter_free_parse_options(options);
+}
+
+TEST_CASE("Checking reports the limits parsing does", "[limits]")
+{
+    const std::string blueprint = doublingBlueprint(12);
+
+    drafter_parse_options* options = drafter_init_parse_options();
+    std::string message;
+
+    SECTION("expanded elements")
+    {
+        drafter_set_limits(options, 0, 1000, 0, 0);
+        message = "data structures expand into too many elements";
+    }
+
+    SECTION("generated asset size")
+    {
+        drafter_set_limits(options, 0, 0, 1024, 0);
+        message = "generated asset exceeds 1024 bytes";
+    }
+
+    const Parse parsed = parse(blueprint, options);
+    const Parse checked = check(blueprint, options);
+
+    REQUIRE(parsed.status == LimitExceeded);
+    REQUIRE(checked.status == LimitExceeded);
+    REQUIRE(parsed.out.find(message) != std::string::npos);
+    REQUIRE(checked.out.find(message) != std::string::npos);
+
+    drafter_free_parse_options(options);
+}
+
+TEST_CASE("Conversion budget runs out of time", "[limits]")
+{
+    drafter_parse_options options;
+    options.limits.time_ms = 60000;
+
+    ConversionBudget fresh(&options);
+    REQUIRE_NOTHROW(fresh.checkTime());
+    REQUIRE(fresh.expandLimits().poll);
+
+    ConversionBudget expired(&options, ConversionBudget::clock::now() - std::chrono::minutes(2));
+    REQUIRE_THROWS_AS(expired.checkTime(), snowcrash::Error);
+    REQUIRE_THROWS_AS(expired.expandLimits().poll(), snowcrash::Error);
+    REQUIRE_THROWS_AS(expired.generationLimits().poll(), snowcrash::Error);
+}
+
+TEST_CASE("Generation stops once it renders more elements than the asset size", "[limits]")
+{
+    using namespace refract;
+
+    auto items = make_element<ArrayElement>();
+    for (int i = 0; i < 100; ++i)
+        items->get().push_back(from_primitive(i));
+    items->attributes().set("typeAttributes", make_element<ArrayElement>(from_primitive("fixed")));
+
+    ElementTraitsCache traits;
+    GenerationLimits limits;
+    limits.size = 50;
+
+    SECTION("JSON Value")
+    {
+        GenerationContext context(traits, limits);
+        REQUIRE_THROWS_AS(generateJsonValue(*items, context), snowcrash::Error);
+    }
+
+    SECTION("JSON Schema")
+    {
+        GenerationContext context(traits, limits);
+        REQUIRE_THROWS_AS(schema::generateJsonSchema(*items, context), snowcrash::Error);
+    }
+
+    SECTION("within the size")
+    {
+        limits.size = 1000;
+        GenerationContext context(traits, limits);
+        REQUIRE_NOTHROW(generateJsonValue(*items, context));
+    }
+
+    SECTION("polling")
+    {
+        std::size_t polled = 0;
+        limits.size = 0;
+        limits.poll = [&polled]() { ++polled; };
+
+        for (std::size_t i = 0; i < GenerationLimits::PollInterval; ++i)
+            items->get().push_back(from_primitive("item"));
+
+        GenerationContext context(traits, limits);
+        generateJsonValue(*items, context);
+        REQUIRE(polled > 0);
+    }
+}
+
+TEST_CASE("Conversion budget without limits bounds nothing", "[limits]")
+{
+    ConversionBudget budget(nullptr);
+
+    const auto limits = budget.expandLimits();
+    REQUIRE(limits.depth == 0);
+    REQUIRE(limits.elements == 0);
+    REQUIRE(!limits.poll);
+    REQUIRE(budget.generationLimits().size == 0);
+    REQUIRE(!budget.generationLimits().poll);
+
+    REQUIRE_NOTHROW(budget.expanded(1000000));
+    REQUIRE_NOTHROW(budget.generated(1000000));
+    REQUIRE_NOTHROW(budget.checkTime());
+}
@@ -0,0 +1,39 @@
+//
+//  test-MediaTypeTable.cc
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "MediaTypeTable.h"
+
+using namespace drafter;
+
+TEST_CASE("Media types are interned per Content-Type value", "[media-type]")
+{
+    MediaTypeTable table;
+
+    const auto& json = table.intern("application/json; charset=utf-8");
+    REQUIRE(json.value.type == "application");
+    REQUIRE(json.value.subtype == "json");
+    REQUIRE(json.value.parameters.size() == 1);
+    REQUIRE(json.serialized == "application/json; charset=utf-8");
+
+    const auto& hal = table.intern("application/hal+json");
+    REQUIRE(hal.value.suffix == "json");
+    REQUIRE(hal.serialized == "application/hal+json");
+
+    REQUIRE(&table.intern("application/json; charset=utf-8") == &json);
+    REQUIRE(table.size() == 2);
+}
+
+TEST_CASE("Missing or malformed Content-Type values intern to an empty media type", "[media-type]")
+{
+    MediaTypeTable table;
+
+    REQUIRE(table.intern("").serialized.empty());
+    REQUIRE(table.intern("not a media type").serialized.empty());
+    REQUIRE(table.size() == 2);
+}
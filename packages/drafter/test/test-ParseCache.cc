@@ -0,0 +1,284 @@
+//
+//  test-ParseCache.cc
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "../src/ParseCache.h"
+#include "../src/options.h"
+
+#if !defined(_WIN32)
+
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <dirent.h>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <utime.h>
+
+using namespace drafter;
+
+namespace
+{
+    struct TemporaryDirectory {
+        std::string path;
+
+        TemporaryDirectory()
+        {
+            char tmpl[] = "/tmp/drafter-cache-XXXXXX";
+            const char* dir = ::mkdtemp(tmpl);
+            REQUIRE(dir);
+            path = dir;
+        }
+
+        ~TemporaryDirectory()
+        {
+            if (DIR* dir = ::opendir(path.c_str())) {
+                while (const dirent* d = ::readdir(dir))
+                    if (std::strcmp(d->d_name, ".") && std::strcmp(d->d_name, ".."))
+                        std::remove((path + "/" + d->d_name).c_str());
+                ::closedir(dir);
+            }
+            ::rmdir(path.c_str());
+        }
+
+        std::size_t entries() const
+        {
+            std::size_t result = 0;
+            if (DIR* dir = ::opendir(path.c_str())) {
+                while (const dirent* d = ::readdir(dir))
+                    if (std::strcmp(d->d_name, ".") && std::strcmp(d->d_name, ".."))
+                        ++result;
+                ::closedir(dir);
+            }
+            return result;
+        }
+    };
+
+    const char* source = "# API\n## GET /\n+ Response 200\n";
+    const std::size_t sourceSize = std::strlen(source);
+} // namespace
+
+TEST_CASE("ParseCache keys depend on source and options", "[parse cache]")
+{
+    drafter_parse_options parseOptions;
+    drafter_serialize_options serializeOptions;
+
+    const auto key = ParseCache::key(source, sourceSize, &parseOptions, &serializeOptions);
+
+    REQUIRE(key == ParseCache::key(source, sourceSize, nullptr, nullptr));
+    REQUIRE(key != ParseCache::key(source, sourceSize - 1, &parseOptions, &serializeOptions));
+    REQUIRE(key != ParseCache::key(source, sourceSize, &parseOptions, &serializeOptions, "cli"));
+
+    parseOptions.flags.set(drafter_parse_options::SKIP_GEN_BODIES);
+    REQUIRE(key != ParseCache::key(source, sourceSize, &parseOptions, &serializeOptions));
+    parseOptions.flags.reset();
+
+    serializeOptions.format = DRAFTER_SERIALIZE_JSON;
+    REQUIRE(key != ParseCache::key(source, sourceSize, &parseOptions, &serializeOptions));
+}
+
+TEST_CASE("ParseCache returns stored entries", "[parse cache]")
+{
+    TemporaryDirectory dir;
+    ParseCache cache(dir.path);
+
+    const auto key = ParseCache::key(source, sourceSize, nullptr, nullptr);
+
+    ParseCache::Entry entry;
+    REQUIRE_FALSE(cache.load(key, entry));
+
+    ParseCache::Entry stored;
+    stored.code = 2;
+    stored.output = std::string("element: parseResult\n\0binary", 29);
+    stored.report = "\nOK.\n";
+    cache.store(key, stored);
+
+    REQUIRE(cache.load(key, entry));
+    REQUIRE(entry.code == stored.code);
+    REQUIRE(entry.output == stored.output);
+    REQUIRE(entry.report == stored.report);
+
+    REQUIRE(dir.entries() == 1);
+}
+
+TEST_CASE("ParseCache drops entries with sizes not matching their file", "[parse cache]")
+{
+    TemporaryDirectory dir;
+    ParseCache cache(dir.path);
+
+    const auto key = ParseCache::key(source, sourceSize, nullptr, nullptr);
+    const std::string file = dir.path + "/" + key + ".entry";
+
+    SECTION("claiming more than the file holds")
+    {
+        std::ofstream(file) << "drafter-parse-cache 1\n0 18446744073709551615 4\nshort";
+    }
+
+    SECTION("truncated")
+    {
+        std::ofstream(file) << "drafter-parse-cache 1\n0 12 0\nshort";
+    }
+
+    SECTION("followed by trailing data")
+    {
+        std::ofstream(file) << "drafter-parse-cache 1\n0 2 0\nshort";
+    }
+
+    ParseCache::Entry entry;
+    REQUIRE_FALSE(cache.load(key, entry));
+    REQUIRE(::access(file.c_str(), F_OK) != 0);
+}
+
+TEST_CASE("ParseCache evicts entries beyond its size limit", "[parse cache]")
+{
+    TemporaryDirectory dir;
+    ParseCache cache(dir.path, 1024);
+
+    ParseCache::Entry stored;
+    stored.output = std::string(600, 'x');
+
+    const auto first = ParseCache::key(source, sourceSize, nullptr, nullptr, "first");
+    const auto second = ParseCache::key(source, sourceSize, nullptr, nullptr, "second");
+
+    cache.store(first, stored);
+    cache.store(second, stored);
+
+    ParseCache::Entry entry;
+    REQUIRE(dir.entries() == 1);
+    REQUIRE(cache.load(second, entry));
+    REQUIRE_FALSE(cache.load(first, entry));
+}
+
+TEST_CASE("ParseCache removes temporary files left behind", "[parse cache]")
+{
+    TemporaryDirectory dir;
+    ParseCache cache(dir.path, 1024);
+
+    const std::string stale = dir.path + "/stale.1.0.tmp";
+    const std::string fresh = dir.path + "/fresh.1.0.tmp";
+
+    std::ofstream(stale) << std::string(600, 'x');
+    std::ofstream(fresh) << std::string(600, 'x');
+
+    struct utimbuf old;
+    old.actime = old.modtime = std::time(nullptr) - 2 * 60 * 60;
+    REQUIRE(::utime(stale.c_str(), &old) == 0);
+
+    ParseCache::Entry stored;
+    stored.output = std::string(300, 'x');
+
+    const auto first = ParseCache::key(source, sourceSize, nullptr, nullptr, "first");
+    const auto second = ParseCache::key(source, sourceSize, nullptr, nullptr, "second");
+
+    cache.store(first, stored);
+
+    REQUIRE(::access(stale.c_str(), F_OK) != 0);
+    REQUIRE(::access(fresh.c_str(), F_OK) == 0);
+
+    // the fresh temporary file counts towards the limit
+    stored.output = std::string(200, 'x');
+    cache.store(second, stored);
+
+    ParseCache::Entry entry;
+    REQUIRE(cache.load(second, entry));
+    REQUIRE_FALSE(cache.load(first, entry));
+}
+
+TEST_CASE("ParseCache rescans its directory only beyond its size limit", "[parse cache]")
+{
+    TemporaryDirectory dir;
+    ParseCache cache(dir.path, 1024);
+
+    ParseCache::Entry stored;
+    stored.output = std::string(100, 'x');
+
+    cache.store(ParseCache::key(source, sourceSize, nullptr, nullptr, "first"), stored);
+
+    const std::string stale = dir.path + "/stale.1.0.tmp";
+    std::ofstream(stale) << std::string(100, 'x');
+
+    struct utimbuf old;
+    old.actime = old.modtime = std::time(nullptr) - 2 * 60 * 60;
+    REQUIRE(::utime(stale.c_str(), &old) == 0);
+
+    cache.store(ParseCache::key(source, sourceSize, nullptr, nullptr, "second"), stored);
+    REQUIRE(::access(stale.c_str(), F_OK) == 0);
+
+    stored.output = std::string(1024, 'x');
+    cache.store(ParseCache::key(source, sourceSize, nullptr, nullptr, "third"), stored);
+    REQUIRE(::access(stale.c_str(), F_OK) != 0);
+}
+
+TEST_CASE("drafter_parse_blueprint_to serves results from cache", "[parse cache]")
+{
+    TemporaryDirectory dir;
+
+    drafter_parse_options* parseOptions = drafter_init_parse_options();
+    drafter_set_cache(parseOptions, dir.path.c_str(), 0);
+
+    char* parsed = nullptr;
+    REQUIRE(DRAFTER_OK == drafter_parse_blueprint_to(source, &parsed, parseOptions, nullptr));
+    REQUIRE(parsed);
+    REQUIRE(dir.entries() == 1);
+
+    char* cached = nullptr;
+    REQUIRE(DRAFTER_OK == drafter_parse_blueprint_to(source, &cached, parseOptions, nullptr));
+    REQUIRE(cached);
+    REQUIRE(std::strcmp(parsed, cached) == 0);
+
+    free(parsed);
+    free(cached);
+    drafter_free_parse_options(parseOptions);
+}
+
+namespace
+{
+    const char* attributesSource = "# API\n## GET /\n+ Response 200 (application/json)\n    + Attributes\n        + id: 42\n";
+
+    int generateAll(void*, drafter_gen_asset, const char*, unsigned int, const char*)
+    {
+        return 1;
+    }
+
+    int generateNone(void*, drafter_gen_asset, const char*, unsigned int, const char*)
+    {
+        return 0;
+    }
+} // namespace
+
+TEST_CASE("drafter_parse_blueprint_to bypasses cache with a generation policy", "[parse cache]")
+{
+    TemporaryDirectory dir;
+
+    drafter_parse_options* parseOptions = drafter_init_parse_options();
+    drafter_set_cache(parseOptions, dir.path.c_str(), 0);
+
+    drafter_set_gen_policy(parseOptions, generateAll, nullptr);
+
+    char* all = nullptr;
+    REQUIRE(DRAFTER_OK == drafter_parse_blueprint_to(attributesSource, &all, parseOptions, nullptr));
+    REQUIRE(all);
+
+    drafter_set_gen_policy(parseOptions, generateNone, nullptr);
+
+    char* none = nullptr;
+    REQUIRE(DRAFTER_OK == drafter_parse_blueprint_to(attributesSource, &none, parseOptions, nullptr));
+    REQUIRE(none);
+
+    REQUIRE(std::strcmp(all, none) != 0);
+    REQUIRE(std::string(all).find("messageBody") != std::string::npos);
+    REQUIRE(std::string(none).find("messageBody") == std::string::npos);
+    REQUIRE(dir.entries() == 0);
+
+    free(all);
+    free(none);
+    drafter_free_parse_options(parseOptions);
+}
+
+#endif
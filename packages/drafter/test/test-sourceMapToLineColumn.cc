@@ -1,6 +1,7 @@
 #include <catch2/catch.hpp>
 
 #include "../src/SourceMapUtils.h"
+#include "../src/ConversionContext.h"
 
 #include <iterator>
 
@@ -161,3 +162,28 @@ TEST_CASE("GetLinesEndIndex - check indexing utf8 chars", "[sourcemap utils]")
     const auto out = GetLinesEndIndex(input);
     REQUIRE(std::equal(expected.begin(), expected.end(), out.begin()));
 }
+
+TEST_CASE("ConversionContext indexes line ends of its source once", "[sourcemap utils]")
+{
+    const static std::string input = "$\n¢\n€\n𐍈\n";
+
+    ConversionContext context(input.c_str());
+
+    const auto& first = context.newlineIndices();
+    REQUIRE(first == GetLinesEndIndex(input));
+    REQUIRE(&first == &context.newlineIndices());
+}
+
+TEST_CASE("ConversionContext of a part of the document shares the line ends of its parent", "[sourcemap utils]")
+{
+    const static std::string input = "$\n¢\n€\n𐍈\n";
+
+    ConversionContext parent(input.c_str());
+    const auto& lines = parent.newlineIndices();
+
+    ConversionContext part(parent, ConversionContext::SharedTypes{});
+    ConversionContext nested(part, ConversionContext::SharedTypes{});
+
+    REQUIRE(&part.newlineIndices() == &lines);
+    REQUIRE(&nested.newlineIndices() == &lines);
+}
@@ -15,6 +15,7 @@
 #include <array>
 #include <string>
 #include <limits>
+#include <vector>
 
 #include "utils/so/JsonIo.h"
 
@@ -57,6 +58,17 @@ namespace
         "utf8_sequence_0-0xff_including-unassigned_including-unprintable-asis_unseparated.txt",
         "utf8_sequence_0-0xff_including-unassigned_including-unprintable-replaced_unseparated.txt"
     };
+
+    // records the size of every write to it
+    struct recording_buf : std::stringbuf {
+        std::vector<std::streamsize> writes;
+
+        std::streamsize xsputn(const char* s, std::streamsize n) override
+        {
+            writes.push_back(n);
+            return std::stringbuf::xsputn(s, n);
+        }
+    };
 }
 
 // clang-format off
@@ -524,5 +536,144 @@ SCENARIO("Serialize a utils::so::Value holding deep objects into indented json",
                 REQUIRE(deep_object_packed == ss.str());
             }
         }
+
+        WHEN("it is appended to a non-empty string buffer as indented JSON")
+        {
+            std::string buffer = "prefix";
+            serialize_json(buffer, value);
+
+            THEN("the buffer holds the prefix followed by the serialization")
+            {
+                REQUIRE(("prefix" + deep_object_indented) == buffer);
+            }
+        }
+
+        WHEN("it is serialized into a reused string buffer as packed JSON")
+        {
+            std::string buffer;
+            serialize_json(buffer, value, packed{});
+            buffer.clear();
+            serialize_json(buffer, value, packed{});
+
+            THEN("it serializes correctly")
+            {
+                REQUIRE(deep_object_packed == buffer);
+            }
+        }
+    }
+}
+
+SCENARIO("Serialize a large utils::so::Value into a stream", "[simple-object][json]")
+{
+    GIVEN("an array of a megabyte of strings")
+    {
+        Array items{};
+        for (int i = 0; i < 32 * 1024; ++i)
+            items.data.emplace_back(String{ std::string(30, 'x') });
+        const Value value{ std::move(items) };
+
+        WHEN("it is serialized into a stream as packed JSON")
+        {
+            recording_buf buf;
+            std::ostream out(&buf);
+            serialize_json(out, value, packed{});
+
+            THEN("it serializes as into a string")
+            {
+                std::string expected;
+                serialize_json(expected, value, packed{});
+                REQUIRE(expected == buf.str());
+            }
+
+            THEN("it is written in bounded chunks")
+            {
+                REQUIRE(buf.writes.size() > 1);
+                for (const auto size : buf.writes)
+                    REQUIRE(size < 128 * 1024);
+            }
+        }
+    }
+}
+
+SCENARIO("Parse JSON into a utils::so::Value", "[simple-object][json][parse]")
+{
+    GIVEN("an indented JSON document")
+    {
+        const std::string json = "{\n  \"foo\": \"Hello world!\",\n  \"empty\": {},\n  \"bar\": {\n    \"id\": 5,\n"
+                                 "    \"data\": [\n      \"Here comes the sun\",\n      true,\n      false,\n"
+                                 "      null,\n      -1.25e+3,\n      []\n    ]\n  }\n}";
+
+        WHEN("it is parsed")
+        {
+            const auto value = parse_json(json.data(), json.size());
+
+            THEN("it serializes back into the same document")
+            {
+                std::string buffer;
+                serialize_json(buffer, value);
+                REQUIRE(json == buffer);
+            }
+        }
+    }
+
+    GIVEN("a string with escape sequences")
+    {
+        const std::string json = R"("a\"b\\c\/d\b\f\n\r\t\u0001\u00e9\u20ac\ud83d\ude00e")";
+
+        WHEN("it is parsed")
+        {
+            const auto value = parse_json(json.data(), json.size());
+
+            THEN("it is unescaped into UTF-8")
+            {
+                REQUIRE(mpark::holds_alternative<String>(value));
+                REQUIRE(mpark::get<String>(value).data
+                    == "a\"b\\c/d\b\f\n\r\t\x01\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80" "e");
+            }
+        }
+    }
+
+    GIVEN("a number")
+    {
+        const std::string json = " 0.10000 ";
+
+        WHEN("it is parsed")
+        {
+            const auto value = parse_json(json.data(), json.size());
+
+            THEN("its textual form is kept")
+            {
+                REQUIRE(mpark::holds_alternative<so::Number>(value));
+                REQUIRE(mpark::get<so::Number>(value).data == "0.10000");
+            }
+        }
+    }
+
+    GIVEN("invalid JSON documents")
+    {
+        const std::string invalid[] = {
+            "",
+            "{",
+            "[1,]",
+            "{\"a\" 1}",
+            "\"unterminated",
+            "\"\\x\"",
+            "\"\\ud83d\"",
+            "\"\t\"",
+            "01",
+            "-",
+            "1.",
+            "tru",
+            "nul",
+            "[] []",
+        };
+
+        THEN("parsing them throws")
+        {
+            for (const auto& json : invalid) {
+                INFO(json);
+                REQUIRE_THROWS_AS(parse_json(json.data(), json.size()), JsonParseError);
+            }
+        }
     }
 }
@@ -0,0 +1,48 @@
+//
+//  test/utils/test-Sha256.cc
+//  test-librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "utils/Sha256.h"
+
+#include <algorithm>
+#include <string>
+
+using namespace drafter::utils;
+
+namespace
+{
+    std::string sha256(const std::string& message)
+    {
+        Sha256 digest;
+        digest.update(message.data(), message.size());
+        return to_hex(digest.finish());
+    }
+} // namespace
+
+TEST_CASE("SHA-256 of FIPS 180-4 example messages", "[sha256]")
+{
+    REQUIRE(sha256("") == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    REQUIRE(sha256("abc") == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    REQUIRE(sha256("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq")
+        == "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+    REQUIRE(sha256(std::string(1000000, 'a')) == "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+}
+
+TEST_CASE("SHA-256 does not depend on how the message is split", "[sha256]")
+{
+    const std::string message(200, 'x');
+
+    Sha256 whole;
+    whole.update(message.data(), message.size());
+
+    Sha256 pieces;
+    for (std::size_t i = 0; i < message.size(); i += 7)
+        pieces.update(message.data() + i, std::min<std::size_t>(7, message.size() - i));
+
+    REQUIRE(to_hex(whole.finish()) == to_hex(pieces.finish()));
+}